@@ -605,6 +605,10 @@ static void create_mesh(Scene *scene,
   }
   mesh->resize_mesh(positions.size(), numtris);
 
+  /* NOTE: The data is copied instead of referencing Blender's arrays. Cycles' `float3` is padded
+   * to 16 bytes and triangles store vertex indices rather than corner indices, so the layouts
+   * don't match. Referencing the arrays would also need the Cycles mesh to keep the evaluated
+   * Blender mesh alive until the render finishes. */
   float3 *verts = mesh->get_verts().data();
   for (const int i : positions.index_range()) {
     verts[i] = make_float3(positions[i][0], positions[i][1], positions[i][2]);
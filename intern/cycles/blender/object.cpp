@@ -549,7 +549,12 @@ void BlenderSync::sync_objects(BL::Depsgraph &b_depsgraph,
   /* initialize culling */
   BlenderObjectCulling culling(scene, b_scene);
 
-  /* object loop */
+  /* Object loop.
+   *
+   * NOTE: Only the geometry data export is multi-threaded, through the task pool. The loop
+   * itself stays serial: the depsgraph instance iterator can only be advanced from one thread,
+   * and creating objects and geometry adds nodes to the scene and the id maps, which are not
+   * thread safe. Geometry that didn't change is skipped by #BlenderSync::sync_geometry. */
   bool cancel = false;
   const bool show_lights = BlenderViewportParameters(b_v3d, use_developer_ui).use_scene_lights;
 
@@ -324,6 +324,26 @@ void BlenderSession::stamp_view_layer_metadata(Scene *scene, const string &view_
                             time_human_readable_from_seconds(render_time).c_str());
   b_rr.stamp_data_add_field((prefix + "synchronization_time").c_str(),
                             time_human_readable_from_seconds(total_time - render_time).c_str());
+
+  /* Store the time of the individual render steps, to help predicting render times. Values are
+   * in seconds so they can be parsed easily. */
+  const RenderScheduler::TimeStatistics time_statistics = session->get_time_statistics();
+  b_rr.stamp_data_add_field((prefix + "path_trace_time").c_str(),
+                            string_printf("%f", time_statistics.path_trace).c_str());
+  if (time_statistics.adaptive_filter > 0.0) {
+    b_rr.stamp_data_add_field((prefix + "adaptive_filter_time").c_str(),
+                              string_printf("%f", time_statistics.adaptive_filter).c_str());
+  }
+  if (time_statistics.denoise > 0.0) {
+    b_rr.stamp_data_add_field((prefix + "denoise_time").c_str(),
+                              string_printf("%f", time_statistics.denoise).c_str());
+  }
+  if (time_statistics.path_trace > 0.0) {
+    b_rr.stamp_data_add_field(
+        (prefix + "samples_per_second").c_str(),
+        string_printf("%f", time_statistics.num_rendered_samples / time_statistics.path_trace)
+            .c_str());
+  }
 }
 
 void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
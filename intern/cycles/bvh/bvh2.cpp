@@ -19,6 +19,7 @@
 #include "bvh/unaligned.h"
 
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -296,10 +297,10 @@ void BVH2::refit_nodes()
 
   BoundBox bbox = BoundBox::empty;
   uint visibility = 0;
-  refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
+  refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility, 0);
 }
 
-void BVH2::refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility)
+void BVH2::refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility, const int level)
 {
   if (leaf) {
     /* refit leaf node */
@@ -331,8 +332,20 @@ void BVH2::refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility
     uint visibility0 = 0;
     uint visibility1 = 0;
 
-    refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0);
-    refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1);
+    /* Sub-trees write to separate nodes, so the top levels can be refit in parallel. This
+     * creates enough tasks without the overhead of spawning them for small sub-trees. */
+    if (level < REFIT_THREAD_LEVELS) {
+      tbb::task_group tasks;
+      tasks.run([&]() {
+        refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0, level + 1);
+      });
+      refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1, level + 1);
+      tasks.wait();
+    }
+    else {
+      refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0, level + 1);
+      refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1, level + 1);
+    }
 
     if (is_unaligned) {
       const Transform aligned_space = transform_identity();
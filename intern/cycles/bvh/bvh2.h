@@ -81,8 +81,10 @@ class BVH2 : public BVH {
                            uint visibility1);
 
   /* refit */
+  /* Number of tree levels that are refit in parallel, giving up to 2^N tasks. */
+  enum { REFIT_THREAD_LEVELS = 6 };
   void refit_nodes();
-  void refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility);
+  void refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility, const int level);
 
   /* Refit range of primitives. */
   void refit_primitives(const int start, const int end, BoundBox &bbox, uint &visibility);
@@ -115,6 +115,10 @@ void PathTraceWorkCPU::render_samples_full_pipeline(ThreadKernelGlobalsCPU *kern
 {
   const bool has_bake = device_scene_->data.bake.use;
 
+  /* NOTE: Each path is traced to completion by the megakernel using a single integrator state
+   * on the stack. Sorting shading points by material like the GPU wavefront path would need
+   * the state of many paths to be stored in memory at once, and the GPU state and queue
+   * layout (see #PathTraceWorkGPU) is not set up for CPU kernels. */
   IntegratorStateCPU integrator_states[2];
 
   IntegratorStateCPU *state = &integrator_states[0];
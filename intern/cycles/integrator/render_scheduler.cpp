@@ -593,6 +593,17 @@ void RenderScheduler::report_rebalance_time(const RenderWork &render_work,
   VLOG_WORK << "Average rebalance time: " << rebalance_time_.get_average() << " seconds.";
 }
 
+RenderScheduler::TimeStatistics RenderScheduler::get_time_statistics() const
+{
+  TimeStatistics statistics;
+  statistics.path_trace = path_trace_time_.get_wall();
+  statistics.adaptive_filter = adaptive_filter_time_.get_wall();
+  statistics.denoise = denoise_time_.get_wall();
+  statistics.display_update = display_update_time_.get_wall();
+  statistics.num_rendered_samples = get_num_rendered_samples();
+  return statistics;
+}
+
 string RenderScheduler::full_report() const
 {
   const double render_wall_time = state_.end_render_time - state_.start_render_time;
@@ -975,7 +986,11 @@ bool RenderScheduler::work_need_denoise(bool &delayed, bool &ready_to_display)
   }
 
   /* When multiple tiles are used the full frame will be denoised.
-   * Avoid per-tile denoising to save up render time. */
+   * Avoid per-tile denoising to save up render time.
+   *
+   * NOTE: Denoising tiles separately could overlap with path tracing of the next tile, but the
+   * denoiser needs pixels beyond the tile borders to avoid visible seams between tiles, and
+   * those are only known once the neighbor tiles have been rendered. */
   if (tile_manager_.has_multiple_tiles()) {
     return false;
   }
@@ -212,6 +212,16 @@ class RenderScheduler {
    * times, and so on. */
   string full_report() const;
 
+  /* Wall time in seconds spent on each type of work since the render started. */
+  struct TimeStatistics {
+    double path_trace = 0.0;
+    double adaptive_filter = 0.0;
+    double denoise = 0.0;
+    double display_update = 0.0;
+    int num_rendered_samples = 0;
+  };
+  TimeStatistics get_time_statistics() const;
+
   void set_limit_samples_per_update(const int limit_samples);
 
  protected:
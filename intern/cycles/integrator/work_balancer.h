@@ -8,6 +8,10 @@
 
 CCL_NAMESPACE_BEGIN
 
+/* NOTE: Work is only balanced between the devices of one multi-device. Balancing across machines
+ * would need a network device that syncs the scene and streams render buffers back, and the
+ * rebalance below assumes the statistics of all devices are known after every sample batch,
+ * which doesn't hold with network latency. */
 struct WorkBalanceInfo {
   /* Time spent performing corresponding work. */
   double time_spent = 0;
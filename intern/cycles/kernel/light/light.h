@@ -56,6 +56,17 @@ ccl_device_inline int light_link_receiver_forward(KernelGlobals kg, IntegratorSt
 #endif
 }
 
+#ifdef __LIGHT_LINKING__
+/* Bit of the light set of the receiver, to test against the light set membership of emitters. */
+ccl_device_inline uint64_t light_link_receiver_mask(KernelGlobals kg, const int object_receiver)
+{
+  const uint receiver_set = (object_receiver != OBJECT_NONE) ?
+                                kernel_data_fetch(objects, object_receiver).receiver_light_set :
+                                0;
+  return uint64_t(1) << uint64_t(receiver_set);
+}
+#endif
+
 ccl_device_inline bool light_link_light_match(KernelGlobals kg,
                                               const int object_receiver,
                                               const int object_emitter)
@@ -66,10 +77,7 @@ ccl_device_inline bool light_link_light_match(KernelGlobals kg,
   }
 
   const uint64_t set_membership = kernel_data_fetch(objects, object_emitter).light_set_membership;
-  const uint receiver_set = (object_receiver != OBJECT_NONE) ?
-                                kernel_data_fetch(objects, object_receiver).receiver_light_set :
-                                0;
-  return ((uint64_t(1) << uint64_t(receiver_set)) & set_membership) != 0;
+  return (light_link_receiver_mask(kg, object_receiver) & set_membership) != 0;
 #else
   return true;
 #endif
@@ -92,10 +100,7 @@ ccl_device_inline bool light_link_object_match(KernelGlobals kg,
   }
 
   const uint64_t set_membership = kernel_data_fetch(objects, object_emitter).light_set_membership;
-  const uint receiver_set = (object_receiver != OBJECT_NONE) ?
-                                kernel_data_fetch(objects, object_receiver).receiver_light_set :
-                                0;
-  return ((uint64_t(1) << uint64_t(receiver_set)) & set_membership) != 0;
+  return (light_link_receiver_mask(kg, object_receiver) & set_membership) != 0;
 #else
   return true;
 #endif
@@ -271,6 +276,15 @@ ccl_device_forceinline int lights_intersect_impl(KernelGlobals kg,
 #ifdef __SHADOW_LINKING__
   const bool is_indirect_ray = !(path_flag & PATH_RAY_CAMERA);
 #endif
+#ifdef __LIGHT_LINKING__
+  /* Camera rays see all lights. For other rays the light set of the receiver is the same for
+   * every light, so it is only looked up once. */
+  const bool use_light_linking = (kernel_data.kernel_features & KERNEL_FEATURE_LIGHT_LINKING) &&
+                                 !(path_flag & PATH_RAY_CAMERA);
+  const uint64_t receiver_mask = use_light_linking ?
+                                     light_link_receiver_mask(kg, receiver_forward) :
+                                     0;
+#endif
 
   for (int lamp = 0; lamp < kernel_data.integrator.num_lights; lamp++) {
     const ccl_global KernelLight *klight = &kernel_data_fetch(lights, lamp);
@@ -322,7 +336,9 @@ ccl_device_forceinline int lights_intersect_impl(KernelGlobals kg,
 
 #ifdef __LIGHT_LINKING__
     /* Light linking. */
-    if (!light_link_light_match(kg, receiver_forward, object) && !(path_flag & PATH_RAY_CAMERA)) {
+    if (use_light_linking &&
+        !(kernel_data_fetch(objects, object).light_set_membership & receiver_mask))
+    {
       continue;
     }
 #endif
@@ -93,7 +93,12 @@ CCL_NAMESPACE_BEGIN
 #  define SVM_CASE(node) case node:
 #endif
 
-/* Main Interpreter Loop */
+/* Main Interpreter Loop
+ *
+ * NOTE: Node programs are interpreted for every shader evaluation, there is no per-material
+ * code generation. On CPU that would need a JIT compiler at render time, which is what OSL
+ * provides. The only specialization is at kernel compile time through `node_feature_mask`,
+ * which removes unused node types from the switch. */
 template<uint node_feature_mask, ShaderType type, typename ConstIntegratorGenericState>
 ccl_device void svm_eval_nodes(KernelGlobals kg,
                                ConstIntegratorGenericState state,
@@ -1495,6 +1495,10 @@ static_assert_align(KernelData, 16);
 
 /* Kernel data structures. */
 
+/* NOTE: Every instance has its own KernelObject, even when it only differs from other instances
+ * of the same geometry by its transform. Splitting out shared parameters would add an
+ * indirection to every object data lookup in the kernel, and the host side #Object nodes that
+ * are created per instance during sync would still dominate memory usage. */
 struct KernelObject {
   Transform tfm;
   Transform itfm;
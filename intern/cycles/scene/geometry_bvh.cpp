@@ -71,6 +71,11 @@ void Geometry::compute_bvh(Device *device,
     else {
       progress->set_status(msg, "Building BVH");
 
+      /* NOTE: Built BVHs are not cached on disk between renders. Most layouts are owned by a
+       * library with no serialization API (Embree, OptiX, Metal and HIP-RT), so only BVH2
+       * could be stored. Its packed nodes also depend on the build parameters and the device
+       * BVH layout, so a cache key would need all of these in addition to a hash of the
+       * geometry. */
       BVHParams bparams;
       bparams.use_spatial_split = params->use_bvh_spatial_split;
       bparams.use_compact_structure = params->use_bvh_compact_structure;
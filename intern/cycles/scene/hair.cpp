@@ -490,7 +490,12 @@ void Hair::pack_curves(Scene *scene,
 {
   const size_t curve_keys_size = curve_keys.size();
 
-  /* pack curve keys */
+  /* pack curve keys
+   *
+   * NOTE: Keys are stored uncompressed as position and radius. Besides the curve evaluation in
+   * the kernel, the Embree, OptiX and Metal curve primitives read control points as four floats
+   * directly, so quantized keys would have to be decoded into a second full precision copy for
+   * BVH building, which defeats the memory savings. */
   if (curve_keys_size) {
     float3 *keys_ptr = curve_keys.data();
     float *radius_ptr = curve_radius.data();
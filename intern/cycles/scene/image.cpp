@@ -706,6 +706,11 @@ void ImageManager::device_load_image(Device *device,
 
   progress.set_status("Updating Images", "Loading " + img->loader->name());
 
+  /* NOTE: Images are always loaded completely, at the resolution allowed by the texture limit.
+   * Loading tiles on demand would need the kernel to report missing tiles and mip levels back
+   * to the host, and to re-execute the affected paths once they are uploaded, since device
+   * memory can't be allocated from the kernel. Until then the texture limit is the way to make
+   * large scenes fit in device memory. */
   const int texture_limit = scene->params.texture_limit;
 
   load_image_metadata(img);
@@ -281,6 +281,13 @@ bool VDBImageLoader::equals(const ImageLoader &other) const
 {
 #ifdef WITH_OPENVDB
   const VDBImageLoader &other_loader = (const VDBImageLoader &)other;
+  /* Volumes that use the same file, grid and frame share their grid through the Blender volume
+   * file cache, so comparing the grid pointer is enough to load it only once. */
+#  ifdef WITH_NANOVDB
+  if (precision != other_loader.precision) {
+    return false;
+  }
+#  endif
   return grid == other_loader.grid;
 #else
   (void)other;
@@ -8,6 +8,7 @@
 
 #include "util/math_fast.h"
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -274,11 +275,24 @@ bool LightTree::triangle_usable_as_light(Mesh *mesh, const int prim_id)
 void LightTree::add_mesh(Scene *scene, Mesh *mesh, const int object_id)
 {
   const size_t mesh_num_triangles = mesh->num_triangles();
+  vector<int> prim_ids;
   for (size_t i = 0; i < mesh_num_triangles; i++) {
     if (triangle_usable_as_light(mesh, i)) {
-      emitters_.emplace_back(scene, i, object_id);
+      prim_ids.push_back(i);
     }
   }
+
+  /* Computing the measure of each triangle is the expensive part for meshes with many emissive
+   * triangles, so create the emitters in parallel. */
+  static const int TRIANGLES_PER_TASK = 4096;
+  const size_t start = emitters_.size();
+  emitters_.resize(start + prim_ids.size());
+  parallel_for(blocked_range<size_t>(0, prim_ids.size(), TRIANGLES_PER_TASK),
+               [&](const blocked_range<size_t> &r) {
+                 for (size_t i = r.begin(); i != r.end(); i++) {
+                   emitters_[start + i] = LightTreeEmitter(scene, prim_ids[i], object_id);
+                 }
+               });
 }
 
 LightTree::LightTree(Scene *scene,
@@ -196,6 +196,7 @@ struct LightTreeEmitter {
 
   LightTreeMeasure measure;
 
+  LightTreeEmitter() = default;
   LightTreeEmitter(Object *object, const int object_id); /* Mesh emitter. */
   LightTreeEmitter(Scene *scene,
                    const int prim_id,
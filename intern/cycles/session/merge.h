@@ -9,7 +9,12 @@
 
 CCL_NAMESPACE_BEGIN
 
-/* Merge OpenEXR multi-layer renders. */
+/* Merge OpenEXR multi-layer renders.
+ *
+ * NOTE: This is also the way to split a long render into chunks that can be restarted: render
+ * disjoint sample subsets (the sample offset and count scene settings) to separate files, then
+ * merge them. Checkpointing a running render isn't supported, since the integrator and
+ * adaptive sampling state is not stored with the render buffers. */
 
 class ImageMerger {
  public:
@@ -768,6 +768,11 @@ void Session::collect_statistics(RenderStats *render_stats)
   }
 }
 
+RenderScheduler::TimeStatistics Session::get_time_statistics() const
+{
+  return render_scheduler_.get_time_statistics();
+}
+
 /* --------------------------------------------------------------------
  * Full-frame on-disk storage.
  */
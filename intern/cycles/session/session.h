@@ -158,6 +158,9 @@ class Session {
 
   void collect_statistics(RenderStats *stats);
 
+  /* Time spent on the different types of render work, see #RenderScheduler. */
+  RenderScheduler::TimeStatistics get_time_statistics() const;
+
   /* --------------------------------------------------------------------
    * Full-frame on-disk storage.
    */
@@ -1157,6 +1157,7 @@ string MANTA::parseLine(const string &line)
     return "";
   }
   string res;
+  res.reserve(line.size());
   int currPos = 0, start_del = 0, end_del = -1;
   bool readingVar = false;
   const char delimiter = '$';
@@ -1164,7 +1165,9 @@ string MANTA::parseLine(const string &line)
     if (line[currPos] == delimiter && !readingVar) {
       readingVar = true;
       start_del = currPos + 1;
-      res += line.substr(end_del + 1, currPos - end_del - 1);
+      /* Append directly instead of creating temporary sub-strings, the scripts are parsed for
+       * every frame (see #updateVariables). */
+      res.append(line, end_del + 1, currPos - end_del - 1);
     }
     else if (line[currPos] == delimiter && readingVar) {
       readingVar = false;
@@ -1173,7 +1176,7 @@ string MANTA::parseLine(const string &line)
     }
     currPos++;
   }
-  res += line.substr(end_del + 1, line.size() - end_del);
+  res.append(line, end_del + 1, line.size() - end_del);
   return res;
 }
 
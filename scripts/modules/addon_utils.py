@@ -332,6 +332,7 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     import os
     import sys
     import importlib
+    from time import perf_counter
     from bpy_restrict_state import RestrictBlend
 
     if handle_error is None:
@@ -426,6 +427,7 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     with RestrictBlend():
 
         # 1) try import
+        time_import = perf_counter()
         try:
             # Use instead of `__import__` so that sub-modules can eventually be supported.
             # This is also documented to be the preferred way to import modules.
@@ -511,6 +513,8 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
         _bl_owner_id_set(module_name)
 
         # 3) Try run the modules register function.
+        time_register = perf_counter()
+        time_import = time_register - time_import
         try:
             mod.register()
         except Exception as ex:
@@ -524,13 +528,17 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
             return None
         finally:
             _bl_owner_id_set(owner_id_prev)
+        time_register = perf_counter() - time_register
 
     # * OK loaded successfully! *
     mod.__addon_enabled__ = True
     mod.__addon_persistent__ = persistent
 
     if _bpy.app.debug_python:
-        print("\taddon_utils.enable", mod.__name__)
+        # Registering includes creating the RNA types of the add-on's classes.
+        print("\taddon_utils.enable {:s} (import {:.2f} ms, register {:.2f} ms)".format(
+            mod.__name__, time_import * 1000.0, time_register * 1000.0,
+        ))
 
     return mod
 
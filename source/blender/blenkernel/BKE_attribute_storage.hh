@@ -56,6 +56,12 @@ class Attribute {
     static SingleData ForValue(const GPointer &value);
     static SingleData ForDefaultValue(const CPPType &type);
   };
+  /**
+   * NOTE: New storage types (e.g. quantized or half precision arrays) could be added here. Reading
+   * them would work through virtual arrays like #SingleData, but they also need support for
+   * writing (which currently expects a span of the attribute type), file read/write and a new
+   * #AttrStorageType, since many algorithms access attribute spans directly.
+   */
   using DataVariant = std::variant<ArrayData, SingleData>;
   friend AttributeStorage;
 
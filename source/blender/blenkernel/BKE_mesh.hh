@@ -152,7 +152,7 @@ struct CornerNormalSpace {
 struct CornerNormalSpaceArray {
   /**
    * Results are added from multiple threads. The lock is an easy way to parallelize adding results
-   * for each corner fan. This method means the order of spaces in the `spaces` vector and
+   * for batches of corner fans. This method means the order of spaces in the `spaces` vector and
    * `corners_by_face` is non-deterministic. That shouldn't affect the final output for the user
    * though.
    */
@@ -102,6 +102,14 @@ float BKE_ocean_jminus_to_foam(float jminus, float coverage);
  * Sampling the ocean surface.
  */
 void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v);
+/**
+ * Same as #BKE_ocean_eval_uv for many coordinates at once. The ocean is only locked once, which
+ * avoids contention when sampling from multiple threads.
+ */
+void BKE_ocean_eval_uv_n(struct Ocean *oc,
+                         struct OceanResult *r_ocr,
+                         const float (*uvs)[2],
+                         int uvs_num);
 /**
  * Use catmullrom interpolation rather than linear.
  */
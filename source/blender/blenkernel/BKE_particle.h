@@ -15,6 +15,7 @@
 #include "BLI_compiler_attrs.h"
 #include "BLI_map.hh"
 #include "BLI_ordered_edge.hh"
+#include "BLI_spatial_hash_grid.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_lib_query.hh" /* For LibraryForeachIDCallbackFlag. */
@@ -82,6 +83,11 @@ typedef struct ParticleSimulationData {
 
 typedef struct SPHData {
   ParticleSystem *psys[10];
+  /**
+   * Neighbor search structures for the alive particles of every system in #psys. Owned by the
+   * caller of #psys_sph_init, so they are shared instead of copied into every thread's data.
+   */
+  const blender::SpatialHashGrid *neighbor_grids;
   ParticleData *pa;
   float mass;
   std::optional<blender::Map<blender::OrderedEdge, int>> eh;
@@ -449,12 +455,19 @@ void psys_apply_child_modifiers(struct ParticleThreadContext *ctx,
                                 struct ParticleCacheKey *parent_keys,
                                 const float parent_orco[3]);
 
-void psys_sph_init(struct ParticleSimulationData *sim, struct SPHData *sphdata);
+/**
+ * \param neighbor_grids: Storage for the neighbor search structure of each coupled system, it
+ * must have 10 elements and outlive the use of \a sphdata.
+ */
+void psys_sph_init(struct ParticleSimulationData *sim,
+                   struct SPHData *sphdata,
+                   blender::MutableSpan<blender::SpatialHashGrid> neighbor_grids,
+                   float cfra);
 void psys_sph_finalize(struct SPHData *sphdata);
 /**
  * Sample the density field at a point in space.
  */
-void psys_sph_density(struct BVHTree *tree, struct SPHData *data, float co[3], float vars[2]);
+void psys_sph_density(struct SPHData *data, float co[3], float vars[2]);
 
 /* For anim.c */
 
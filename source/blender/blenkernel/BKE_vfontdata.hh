@@ -10,6 +10,8 @@
  *   and to load them from PostScript fonts.
  */
 
+#include "BLI_span.hh"
+
 #include "DNA_listBase.h"
 
 struct GHash;
@@ -64,4 +66,9 @@ VFontData *BKE_vfontdata_from_freetypefont(PackedFile *pf);
 VFontData *BKE_vfontdata_copy(const VFontData *vfont_src, int flag);
 
 VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, unsigned int character);
+/**
+ * Load all \a characters that are not in the character map of \a vfont yet. Unlike calling
+ * #BKE_vfontdata_char_from_freetypefont for each of them, the font is only loaded once.
+ */
+void BKE_vfontdata_chars_from_freetypefont(VFont *vfont, blender::Span<unsigned int> characters);
 VChar *BKE_vfontdata_char_copy(const VChar *vchar_src);
@@ -820,6 +820,12 @@ void BKE_pose_eval_init(Depsgraph *depsgraph, Scene * /*scene*/, Object *object)
 
   BLI_assert(object->type == OB_ARMATURE);
 
+  /* NOTE: The evaluated pose is not cached per frame. Bones are evaluated by separate depsgraph
+   * operations, and their result depends on much more than the action and frame: drivers,
+   * constraint targets on other objects, NLA state and interactive edits. A cache keyed by
+   * frame would need an invalidation counter covering all of these, which the depsgraph does
+   * not provide for flushed (indirect) updates. */
+
   /* We demand having proper pose. */
   BLI_assert(object->pose != nullptr);
   BLI_assert((object->pose->flag & POSE_RECALC) == 0);
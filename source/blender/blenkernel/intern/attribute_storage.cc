@@ -163,6 +163,14 @@ Attribute::DataVariant &Attribute::data_for_write()
       return data_;
     }
     const CPPType &type = attribute_type_to_cpp_type(type_);
+    /* See #ensure_layer_data_is_mutable in `customdata.cc`. */
+    CLOG_INFO(&LOG,
+              2,
+              "Copy shared attribute \"%s\" (%s) with %lld elements, %lld bytes",
+              name_.c_str(),
+              type.name().c_str(),
+              (long long int)data->size,
+              (long long int)(data->size * type.size));
     ArrayData new_data = ArrayData::ForConstructed(type, data->size);
     type.copy_construct_n(data->data, new_data.data, data->size);
     *data = std::move(new_data);
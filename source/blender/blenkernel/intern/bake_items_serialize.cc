@@ -98,6 +98,11 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
+  /* NOTE: The data is read directly into the final arrays, which are then shared with the
+   * evaluated geometry and across frames (see #BlobReadSharing), so there is only one copy.
+   * Memory mapping the blob files to avoid that copy is not done, because the mapped data would
+   * have to stay valid for as long as the geometry exists, while the files may be overwritten or
+   * deleted when re-baking. */
   std::lock_guard lock{mutex_};
   std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
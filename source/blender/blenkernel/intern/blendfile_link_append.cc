@@ -233,11 +233,27 @@ int BKE_blendfile_link_append_context_item_idtypes_from_library_add(
   short id_code;
 
   BlendfileLinkAppendContextLibrary &lib_context = lapp_context->libraries[library_index];
-  BlendHandle *blo_handle = link_append_context_library_blohandle_ensure(
-      *lapp_context, lib_context, reports);
 
-  if (blo_handle == nullptr) {
-    return BLENDFILE_LINK_APPEND_INVALID;
+  /* When the library file is not opened yet, list its content from the cached data-blocks index
+   * instead, the file will only be opened if anything actually gets linked from it. */
+  const bool use_index = lib_context.blo_handle == nullptr &&
+                         lib_context.path != BLO_EMBEDDED_STARTUP_BLEND;
+  BlendHandle *blo_handle = nullptr;
+  BlendFileIndex *blend_index = nullptr;
+  if (use_index) {
+    if (reports != nullptr) {
+      lib_context.bf_reports.reports = reports;
+    }
+    blend_index = BLO_blendfile_index_read(lib_context.path.c_str(), &lib_context.bf_reports);
+    if (blend_index == nullptr) {
+      return BLENDFILE_LINK_APPEND_INVALID;
+    }
+  }
+  else {
+    blo_handle = link_append_context_library_blohandle_ensure(*lapp_context, lib_context, reports);
+    if (blo_handle == nullptr) {
+      return BLENDFILE_LINK_APPEND_INVALID;
+    }
   }
 
   const bool use_assets_only = (lapp_context->params->flag & FILE_ASSETS_ONLY) != 0;
@@ -250,8 +266,11 @@ int BKE_blendfile_link_append_context_item_idtypes_from_library_add(
     }
 
     int id_names_num;
-    LinkNode *id_names_list = BLO_blendhandle_get_datablock_names(
-        blo_handle, id_code, use_assets_only, &id_names_num);
+    LinkNode *id_names_list = use_index ?
+                                  BLO_blendfile_index_get_datablock_names(
+                                      blend_index, id_code, use_assets_only, &id_names_num) :
+                                  BLO_blendhandle_get_datablock_names(
+                                      blo_handle, id_code, use_assets_only, &id_names_num);
 
     for (LinkNode *link_next = nullptr; id_names_list != nullptr; id_names_list = link_next) {
       link_next = id_names_list->next;
@@ -269,6 +288,10 @@ int BKE_blendfile_link_append_context_item_idtypes_from_library_add(
     id_num += id_names_num;
   }
 
+  if (blend_index) {
+    BLO_blendfile_index_free(blend_index);
+  }
+
   return id_num;
 }
 
@@ -608,6 +608,25 @@ static bool try_direct_evaluate_point_data(const CurvesGeometry &main,
   return true;
 }
 
+/**
+ * Interpolating a single value gives the same value everywhere, so there is no need to evaluate
+ * the attribute on the curves first. Only done for the point domain, where every mesh element
+ * gets a value from the curve points.
+ */
+static bool try_fill_single_point_data(const GVArray &src,
+                                       const AttrDomain dst_domain,
+                                       GMutableSpan dst)
+{
+  if (dst_domain != AttrDomain::Point || !src.is_single()) {
+    return false;
+  }
+  BUFFER_FOR_CPP_TYPE_VALUE(src.type(), value);
+  src.get_internal_single_to_uninitialized(value);
+  src.type().fill_assign_n(value, dst.data(), dst.size());
+  src.type().destruct(value);
+  return true;
+}
+
 static void copy_main_point_domain_attribute_to_mesh(const CurvesInfo &curves_info,
                                                      const StringRef id,
                                                      const ResultOffsets &offsets,
@@ -626,6 +645,10 @@ static void copy_main_point_domain_attribute_to_mesh(const CurvesInfo &curves_in
   if (!dst_attribute) {
     return;
   }
+  if (try_fill_single_point_data(*src_attribute, dst_domain, dst_attribute.span)) {
+    dst_attribute.finish();
+    return;
+  }
   if (dst_domain == AttrDomain::Point) {
     if (try_direct_evaluate_point_data(curves_info.main, src_attribute, dst_attribute.span)) {
       dst_attribute.finish();
@@ -990,6 +1013,10 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
     }
 
     if (src_domain == AttrDomain::Point) {
+      if (try_fill_single_point_data(src, dst_domain, dst.span)) {
+        dst.finish();
+        return;
+      }
       copy_profile_point_domain_attribute_to_mesh(curves_info,
                                                   offsets,
                                                   dst_domain,
@@ -2564,6 +2564,15 @@ static void ensure_layer_data_is_mutable(CustomDataLayer &layer, const int totel
   else {
     const eCustomDataType type = eCustomDataType(layer.type);
     const void *old_data = layer.data;
+    /* Copying shared data is expected in some cases, but hidden copies can use a lot of memory.
+     * Logging them makes it possible to find out where they come from. */
+    CLOG_INFO(&LOG,
+              2,
+              "Copy shared layer \"%s\" (%s) with %d elements, %lld bytes",
+              layer.name,
+              layerType_getName(type),
+              totelem,
+              (long long int)totelem * layerType_getInfo(type)->size);
     /* Copy the layer before removing the user because otherwise the data might be freed while
      * we're still copying from it here. */
     layer.data = copy_layer_data(type, old_data, totelem);
@@ -424,30 +424,19 @@ FCurve *BKE_fcurve_find_by_rna_context_ui(bContext * /*C*/,
  * with optional argument for precision required.
  * Returns the index to insert at (data already at that index will be offset if replace is 0)
  */
-static int BKE_fcurve_bezt_binarysearch_index_ex(const BezTriple array[],
-                                                 const float frame,
-                                                 const int arraylen,
-                                                 const float threshold,
-                                                 bool *r_replace)
+template<typename GetFrameFn>
+static int fcurve_binarysearch_index_impl(const GetFrameFn &get_frame,
+                                          const float frame,
+                                          const int arraylen,
+                                          const float threshold,
+                                          bool *r_replace)
 {
   int start = 0, end = arraylen;
   int loopbreaker = 0, maxloop = arraylen * 2;
 
-  /* Initialize replace-flag first. */
-  *r_replace = false;
-
-  /* Sneaky optimizations (don't go through searching process if...):
-   * - Keyframe to be added is to be added out of current bounds.
-   * - Keyframe to be added would replace one of the existing ones on bounds.
-   */
-  if (arraylen <= 0 || array == nullptr) {
-    CLOG_WARN(&LOG, "encountered invalid array");
-    return 0;
-  }
-
   /* Check whether to add before/after/on. */
   /* 'First' Keyframe (when only one keyframe, this case is used) */
-  float framenum = array[0].vec[1][0];
+  float framenum = get_frame(0);
   if (IS_EQT(frame, framenum, threshold)) {
     *r_replace = true;
     return 0;
@@ -457,7 +446,7 @@ static int BKE_fcurve_bezt_binarysearch_index_ex(const BezTriple array[],
   }
 
   /* 'Last' Keyframe */
-  framenum = array[(arraylen - 1)].vec[1][0];
+  framenum = get_frame(arraylen - 1);
   if (IS_EQT(frame, framenum, threshold)) {
     *r_replace = true;
     return (arraylen - 1);
@@ -475,7 +464,7 @@ static int BKE_fcurve_bezt_binarysearch_index_ex(const BezTriple array[],
     /* We calculate the midpoint this way to avoid int overflows... */
     const int mid = start + ((end - start) / 2);
 
-    const float midfra = array[mid].vec[1][0];
+    const float midfra = get_frame(mid);
 
     /* Check if exactly equal to midpoint. */
     if (IS_EQT(frame, midfra, threshold)) {
@@ -509,6 +498,28 @@ static int BKE_fcurve_bezt_binarysearch_index_ex(const BezTriple array[],
   return start;
 }
 
+static int BKE_fcurve_bezt_binarysearch_index_ex(const BezTriple array[],
+                                                 const float frame,
+                                                 const int arraylen,
+                                                 const float threshold,
+                                                 bool *r_replace)
+{
+  /* Initialize replace-flag first. */
+  *r_replace = false;
+
+  /* Sneaky optimizations (don't go through searching process if...):
+   * - Keyframe to be added is to be added out of current bounds.
+   * - Keyframe to be added would replace one of the existing ones on bounds.
+   */
+  if (arraylen <= 0 || array == nullptr) {
+    CLOG_WARN(&LOG, "encountered invalid array");
+    return 0;
+  }
+
+  return fcurve_binarysearch_index_impl(
+      [&](const int i) { return array[i].vec[1][0]; }, frame, arraylen, threshold, r_replace);
+}
+
 int BKE_fcurve_bezt_binarysearch_index(const BezTriple array[],
                                        const float frame,
                                        const int arraylen,
@@ -2005,27 +2016,26 @@ static float fcurve_eval_keyframes_extrapolate(const FCurve *fcu,
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
-static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
-                                               const BezTriple *bezts,
-                                               float evaltime)
+/* Threshold used to find the keyframes of the segment to evaluate.
+ *
+ * The threshold here has the following constraints:
+ * - 0.001 is too coarse:
+ *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
+ *
+ * - 0.00001 is too fine:
+ *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
+ *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
+ */
+static constexpr float FCURVE_EVAL_BINARYSEARCH_THRESH = 0.0001f;
+
+/* Evaluate the segment ending at keyframe `a`, as found by the binary search. */
+static float fcurve_eval_keyframes_segment(const FCurve *fcu,
+                                           const BezTriple *bezts,
+                                           float evaltime,
+                                           const int a,
+                                           const bool exact)
 {
   const float eps = 1.e-8f;
-  uint a;
-
-  /* Evaluation-time occurs somewhere in the middle of the curve. */
-  bool exact = false;
-
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
-   * - 0.001 is too coarse:
-   *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
-   *
-   * - 0.00001 is too fine:
-   *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
-   *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
-   */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
@@ -2268,6 +2278,19 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
   return 0.0f;
 }
 
+static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
+                                               const BezTriple *bezts,
+                                               float evaltime)
+{
+  /* Evaluation-time occurs somewhere in the middle of the curve. */
+  bool exact = false;
+
+  /* Use binary search to find appropriate keyframes... */
+  const int a = BKE_fcurve_bezt_binarysearch_index_ex(
+      bezts, evaltime, fcu->totvert, FCURVE_EVAL_BINARYSEARCH_THRESH, &exact);
+  return fcurve_eval_keyframes_segment(fcu, bezts, evaltime, a, exact);
+}
+
 /* Calculate F-Curve value for 'evaltime' using #BezTriple keyframes. */
 static float fcurve_eval_keyframes(const FCurve *fcu, const BezTriple *bezts, float evaltime)
 {
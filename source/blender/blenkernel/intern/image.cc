@@ -4317,6 +4317,9 @@ static ImBuf *load_image_single(Image *ima,
 
 /* warning, 'iuser' can be null
  * NOTE: Image->views was already populated (in image_update_views_format)
+ * NOTE: Sequence frames are loaded on demand, there is no read-ahead. Files are memory mapped by
+ * the image readers, and frames stay in the image cache once loaded. The movie clip editor has
+ * its own prefetch job for sequences (see `clip_editor.cc`).
  */
 static ImBuf *image_load_image_file(
     Image *ima, ImageUser *iuser, int entry, int cfra, bool is_sequence)
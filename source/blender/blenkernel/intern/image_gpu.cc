@@ -313,6 +313,12 @@ static void image_gpu_texture_partial_update_changes_available(
   }
 }
 
+/**
+ * \note Partial updates only reduce the amount of data that is uploaded, the whole image stays
+ * resident on the GPU. There is no virtual texturing where only the visible tiles at the needed
+ * mip level are resident, as the textures are sampled directly by the material and paint shaders
+ * of all engines. The GPU memory can be reduced with the texture size limit in the preferences.
+ */
 static void image_gpu_texture_try_partial_update(Image *image, ImageUser *iuser)
 {
   PartialUpdateChecker<ImageTileData> checker(image, iuser, image->runtime->partial_update_user);
@@ -606,11 +612,28 @@ void BKE_image_free_old_gputextures(Main *bmain)
 
   lasttime = ctime;
 
+  /* When the GPU is running low on memory, don't wait for the full timeout before freeing
+   * textures that are not in use. Only the GPU textures are affected, image buffers in main
+   * memory keep using the user preference. */
+  int gpu_timeout = U.textimeout;
+  if (GPU_mem_stats_supported()) {
+    int totalmem = 0, freemem = 0;
+    GPU_mem_stats_get(&totalmem, &freemem);
+    if (totalmem > 0 && freemem < totalmem / 10) {
+      gpu_timeout = std::min(U.textimeout, U.texcollectrate);
+    }
+  }
+
   LISTBASE_FOREACH (Image *, ima, &bmain->images) {
-    if ((ima->flag & IMA_NOCOLLECT) == 0 && ctime - ima->lastused > U.textimeout) {
+    if (ima->flag & IMA_NOCOLLECT) {
+      continue;
+    }
+    const bool has_gpu_texture = BKE_image_has_opengl_texture(ima);
+    const int timeout = has_gpu_texture ? gpu_timeout : U.textimeout;
+    if (ctime - ima->lastused > timeout) {
       /* If it's in GL memory, deallocate and set time tag to current time
        * This gives textures a "second chance" to be used before dying. */
-      if (BKE_image_has_opengl_texture(ima)) {
+      if (has_gpu_texture) {
         BKE_image_free_gputextures(ima);
         ima->lastused = ctime;
       }
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <atomic>
 #include <cerrno>
 #include <cstring>
 
@@ -1108,54 +1109,71 @@ bool BKE_image_render_write(ReportList *reports,
 
   /* mono, legacy code */
   else if (is_mono || (image_format.views_format == R_IMF_VIEWS_INDIVIDUAL)) {
-    int view_id = 0;
-    for (const RenderView *rv = (const RenderView *)rr->views.first; rv; rv = rv->next, view_id++)
-    {
-      char filepath[FILE_MAX];
-      if (is_mono) {
-        STRNCPY(filepath, filepath_basis);
-      }
-      else {
-        BKE_scene_multiview_view_filepath_get(&scene->r, filepath_basis, rv->name, filepath);
-      }
+    /* Every view is written to its own file, so the views are written in parallel. The encoders
+     * of the image formats are mostly single threaded. */
+    blender::Vector<const RenderView *> views;
+    LISTBASE_FOREACH (const RenderView *, rv, &rr->views) {
+      views.append(rv);
+    }
+    std::atomic<bool> all_ok = true;
+    blender::threading::parallel_for(views.index_range(), 1, [&](const blender::IndexRange range) {
+      for (const int view_id : range) {
+        const RenderView *rv = views[view_id];
+        /* The format is changed for the optional preview image. */
+        ImageFormatData view_format = image_format;
+        bool view_ok;
+
+        char filepath[FILE_MAX];
+        if (is_mono) {
+          STRNCPY(filepath, filepath_basis);
+        }
+        else {
+          BKE_scene_multiview_view_filepath_get(&scene->r, filepath_basis, rv->name, filepath);
+        }
 
-      if (is_exr_rr) {
-        ok = BKE_image_render_write_exr(
-            reports, rr, filepath, &image_format, save_as_render, rv->name, -1);
-        image_render_print_save_message(reports, filepath, ok, errno);
+        if (is_exr_rr) {
+          view_ok = BKE_image_render_write_exr(
+              reports, rr, filepath, &view_format, save_as_render, rv->name, -1);
+          image_render_print_save_message(reports, filepath, view_ok, errno);
 
-        /* optional preview images for exr */
-        if (ok && (image_format.flag & R_IMF_FLAG_PREVIEW_JPG)) {
-          image_format.imtype = R_IMF_IMTYPE_JPEG90;
-          image_format.depth = R_IMF_CHAN_DEPTH_8;
+          /* optional preview images for exr */
+          if (view_ok && (view_format.flag & R_IMF_FLAG_PREVIEW_JPG)) {
+            view_format.imtype = R_IMF_IMTYPE_JPEG90;
+            view_format.depth = R_IMF_CHAN_DEPTH_8;
 
-          if (BLI_path_extension_check(filepath, ".exr")) {
-            filepath[strlen(filepath) - 4] = 0;
-          }
-          BKE_image_path_ext_from_imformat_ensure(filepath, sizeof(filepath), &image_format);
+            if (BLI_path_extension_check(filepath, ".exr")) {
+              filepath[strlen(filepath) - 4] = 0;
+            }
+            BKE_image_path_ext_from_imformat_ensure(filepath, sizeof(filepath), &view_format);
 
-          ImBuf *ibuf = RE_render_result_rect_to_ibuf(rr, &image_format, dither, view_id);
-          ibuf->planes = 24;
-          IMB_colormanagement_imbuf_for_write(ibuf, save_as_render, false, &image_format);
+            ImBuf *ibuf = RE_render_result_rect_to_ibuf(rr, &view_format, dither, view_id);
+            ibuf->planes = 24;
+            IMB_colormanagement_imbuf_for_write(ibuf, save_as_render, false, &view_format);
 
-          ok = image_render_write_stamp_test(
-              reports, scene, rr, ibuf, filepath, &image_format, stamp);
+            view_ok = image_render_write_stamp_test(
+                reports, scene, rr, ibuf, filepath, &view_format, stamp);
 
-          IMB_freeImBuf(ibuf);
+            IMB_freeImBuf(ibuf);
+          }
         }
-      }
-      else {
-        ImBuf *ibuf = RE_render_result_rect_to_ibuf(rr, &image_format, dither, view_id);
+        else {
+          ImBuf *ibuf = RE_render_result_rect_to_ibuf(rr, &view_format, dither, view_id);
 
-        IMB_colormanagement_imbuf_for_write(ibuf, save_as_render, false, &image_format);
+          IMB_colormanagement_imbuf_for_write(ibuf, save_as_render, false, &view_format);
 
-        ok = image_render_write_stamp_test(
-            reports, scene, rr, ibuf, filepath, &image_format, stamp);
+          view_ok = image_render_write_stamp_test(
+              reports, scene, rr, ibuf, filepath, &view_format, stamp);
 
-        /* imbuf knows which rects are not part of ibuf */
-        IMB_freeImBuf(ibuf);
+          /* imbuf knows which rects are not part of ibuf */
+          IMB_freeImBuf(ibuf);
+        }
+
+        if (!view_ok) {
+          all_ok = false;
+        }
       }
-    }
+    });
+    ok = all_ok;
   }
   else { /* R_IMF_VIEWS_STEREO_3D */
     BLI_assert(image_format.views_format == R_IMF_VIEWS_STEREO_3D);
@@ -6,12 +6,15 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
+#include "MEM_guardedalloc.h"
+
+#include "atomic_ops.h"
+
 #include "BLI_array_utils.hh"
-#include "BLI_math_base.h"
 #include "BLI_ordered_edge.hh"
 #include "BLI_task.hh"
-#include "BLI_threads.h"
-#include "BLI_vector_set.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -19,155 +22,215 @@
 
 namespace blender::bke {
 
-namespace calc_edges {
-
 /**
- * Return a hash value that is likely to be different in the low bits from the normal `hash()`
- * function. This is necessary to avoid collisions in #mesh_calc_edges.
+ * Edges are deduplicated by grouping them by their lower vertex index. Every vertex gets a small
+ * group containing the higher vertex index of all edge candidates starting at it. After sorting
+ * each group, duplicates are next to each other and can be removed. Compared to using hash maps,
+ * this scales with the number of threads and uses less memory.
+ *
+ * Every candidate also stores its position in the order the edges are first encountered in:
+ * existing edges first, then the edges of the faces in corner order. The first occurrence of
+ * every edge is kept, and the edges are written in that order, so the result doesn't depend on
+ * the number of threads or the vertex indices.
  */
-static uint64_t edge_hash_2(const OrderedEdge &edge)
+namespace calc_edges {
+
+struct EdgeCandidate {
+  int v_high;
+  /** The position in the order of first occurrence, replaced by the edge index when it's known. */
+  int index;
+};
+
+template<typename Fn>
+static void foreach_face_edge(const IndexRange face, const Span<int> corner_verts, const Fn &fn)
 {
-  return edge.v_low;
+  for (const int corner : face) {
+    const int corner_next = bke::mesh::face_corner_next(face, corner);
+    const int vert = corner_verts[corner];
+    const int vert_next = corner_verts[corner_next];
+    /* Can only be the same when the mesh data is invalid. */
+    if (LIKELY(vert != vert_next)) {
+      fn(corner, corner_next, OrderedEdge(vert, vert_next));
+    }
+  }
 }
 
-using EdgeMap = VectorSet<OrderedEdge,
-                          16,
-                          DefaultProbingStrategy,
-                          DefaultHash<OrderedEdge>,
-                          DefaultEquality<OrderedEdge>,
-                          SimpleVectorSetSlot<OrderedEdge, int>,
-                          GuardedAllocator>;
-
-static void reserve_hash_maps(const Mesh &mesh,
-                              const bool keep_existing_edges,
-                              MutableSpan<EdgeMap> edge_maps)
+static void count_edge_candidates(const OffsetIndices<int> faces,
+                                  const Span<int> corner_verts,
+                                  const Span<int2> existing_edges,
+                                  MutableSpan<int> counts)
 {
-  const int totedge_guess = std::max(keep_existing_edges ? mesh.edges_num : 0, mesh.faces_num * 2);
-  threading::parallel_for_each(
-      edge_maps, [&](EdgeMap &edge_map) { edge_map.reserve(totedge_guess / edge_maps.size()); });
+  threading::parallel_for(existing_edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const int2 edge : existing_edges.slice(range)) {
+      atomic_add_and_fetch_int32(&counts[OrderedEdge(edge).v_low], 1);
+    }
+  });
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face : range) {
+      foreach_face_edge(faces[face],
+                        corner_verts,
+                        [&](const int /*corner*/, const int /*corner_next*/, OrderedEdge edge) {
+                          atomic_add_and_fetch_int32(&counts[edge.v_low], 1);
+                        });
+    }
+  });
 }
 
-static void add_existing_edges_to_hash_maps(const Mesh &mesh,
-                                            const uint32_t parallel_mask,
-                                            MutableSpan<EdgeMap> edge_maps)
+static void gather_edge_candidates(const OffsetIndices<int> faces,
+                                   const Span<int> corner_verts,
+                                   const Span<int2> existing_edges,
+                                   const OffsetIndices<int> candidate_offsets,
+                                   MutableSpan<EdgeCandidate> candidates)
 {
-  /* Assume existing edges are valid. */
-  const Span<int2> edges = mesh.edges();
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    for (const int2 edge : edges) {
-      const OrderedEdge ordered_edge(edge);
-      /* Only add the edge when it belongs into this map. */
-      if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-        edge_map.add(ordered_edge);
-      }
+  /* See #reverse_indices_in_groups in `mesh_mapping.cc`. */
+  int *counts = MEM_calloc_arrayN<int>(size_t(candidate_offsets.size()), __func__);
+  BLI_SCOPED_DEFER([&]() { MEM_freeN(counts); })
+  auto add_candidate = [&](const OrderedEdge edge, const int order_index) {
+    const int index_in_group = atomic_fetch_and_add_int32(&counts[edge.v_low], 1);
+    candidates[candidate_offsets[edge.v_low][index_in_group]] = {edge.v_high, order_index};
+  };
+  threading::parallel_for(existing_edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const int edge : range) {
+      add_candidate(OrderedEdge(existing_edges[edge]), edge);
+    }
+  });
+  const int existing_num = existing_edges.size();
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face : range) {
+      foreach_face_edge(
+          faces[face],
+          corner_verts,
+          [&](const int /*corner*/, const int corner_next, const OrderedEdge edge) {
+            /* Face edges are ordered by the corner they end at, so the edge between the last
+             * and the first corner of a face comes first. */
+            add_candidate(edge, existing_num + corner_next);
+          });
     }
   });
 }
 
-static void add_face_edges_to_hash_maps(const Mesh &mesh,
-                                        const uint32_t parallel_mask,
-                                        MutableSpan<EdgeMap> edge_maps)
+/**
+ * Sort the candidates for every vertex and move the first occurrence of every edge to the start
+ * of each group.
+ * \param r_unique_counts: The number of unique edges starting at each vertex.
+ */
+static void deduplicate_edge_candidates(const OffsetIndices<int> candidate_offsets,
+                                        MutableSpan<EdgeCandidate> candidates,
+                                        MutableSpan<int> r_unique_counts)
 {
-  const OffsetIndices<int> faces = mesh.faces();
-  const Span<int> corner_verts = mesh.corner_verts();
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    for (const int face_i : faces.index_range()) {
-      const IndexRange face = faces[face_i];
-      for (const int corner : face) {
-        const int vert = corner_verts[corner];
-        const int vert_prev = corner_verts[bke::mesh::face_corner_prev(face, corner)];
-        /* Can only be the same when the mesh data is invalid. */
-        if (LIKELY(vert_prev != vert)) {
-          const OrderedEdge ordered_edge(vert_prev, vert);
-          /* Only add the edge when it belongs into this map. */
-          if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-            edge_map.add(ordered_edge);
-          }
-        }
-      }
+  threading::parallel_for(candidate_offsets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert : range) {
+      MutableSpan<EdgeCandidate> group = candidates.slice(candidate_offsets[vert]);
+      std::sort(group.begin(), group.end(), [](const EdgeCandidate &a, const EdgeCandidate &b) {
+        return a.v_high < b.v_high || (a.v_high == b.v_high && a.index < b.index);
+      });
+      const EdgeCandidate *unique_end = std::unique(
+          group.begin(), group.end(), [](const EdgeCandidate &a, const EdgeCandidate &b) {
+            return a.v_high == b.v_high;
+          });
+      r_unique_counts[vert] = unique_end - group.begin();
     }
   });
 }
 
-static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
-                                                        const OffsetIndices<int> edge_offsets,
-                                                        MutableSpan<int2> new_edges)
+/**
+ * Find the index of every unique edge from its position in the order of first occurrence, and
+ * store it in the candidates.
+ * \return The number of edges.
+ */
+static int assign_edge_indices(const OffsetIndices<int> candidate_offsets,
+                               const Span<int> unique_counts,
+                               const int order_size,
+                               MutableSpan<EdgeCandidate> candidates)
 {
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    if (edge_offsets[task_index].is_empty()) {
-      return;
+  Array<int> edge_offsets_data(order_size + 1, 0);
+  threading::parallel_for(candidate_offsets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert : range) {
+      const IndexRange group = candidate_offsets[vert].take_front(unique_counts[vert]);
+      for (const EdgeCandidate &candidate : candidates.slice(group)) {
+        edge_offsets_data[candidate.index] = 1;
+      }
+    }
+  });
+  const OffsetIndices<int> edge_offsets = offset_indices::accumulate_counts_to_offsets(
+      edge_offsets_data);
+  threading::parallel_for(candidate_offsets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert : range) {
+      const IndexRange group = candidate_offsets[vert].take_front(unique_counts[vert]);
+      for (EdgeCandidate &candidate : candidates.slice(group)) {
+        candidate.index = edge_offsets[candidate.index].start();
+      }
     }
-
-    MutableSpan<int2> result_edges = new_edges.slice(edge_offsets[task_index]);
-    result_edges.copy_from(edge_map.as_span().cast<int2>());
   });
+  return edge_offsets.total_size();
 }
 
-static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
-                                              const Span<int> corner_verts,
-                                              const Span<EdgeMap> edge_maps,
-                                              const uint32_t parallel_mask,
-                                              const OffsetIndices<int> edge_offsets,
-                                              MutableSpan<int> corner_edges)
+static void build_edges(const OffsetIndices<int> candidate_offsets,
+                        const Span<EdgeCandidate> candidates,
+                        const Span<int> unique_counts,
+                        MutableSpan<int2> edges)
 {
-  threading::parallel_for(faces.index_range(), 100, [&](IndexRange range) {
-    for (const int face_index : range) {
-      const IndexRange face = faces[face_index];
-      for (const int corner : face) {
-        const int vert = corner_verts[corner];
-        const int vert_prev = corner_verts[bke::mesh::face_corner_next(face, corner)];
-        if (UNLIKELY(vert == vert_prev)) {
-          /* This is an invalid edge; normally this does not happen in Blender,
-           * but it can be part of an imported mesh with invalid geometry. See
-           * #76514. */
-          corner_edges[corner] = 0;
-          continue;
-        }
-
-        const OrderedEdge ordered_edge(vert_prev, vert);
-        const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-        const EdgeMap &edge_map = edge_maps[task_index];
-        const int edge_i = edge_map.index_of(ordered_edge);
-        const int edge_index = edge_offsets[task_index][edge_i];
-        corner_edges[corner] = edge_index;
+  threading::parallel_for(candidate_offsets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert : range) {
+      const IndexRange group = candidate_offsets[vert].take_front(unique_counts[vert]);
+      for (const EdgeCandidate &candidate : candidates.slice(group)) {
+        edges[candidate.index] = int2(vert, candidate.v_high);
       }
     }
   });
 }
 
-static int get_parallel_maps_count(const Mesh &mesh)
+/** Find the index of an edge that is known to exist. */
+static int edge_index_find(const OffsetIndices<int> candidate_offsets,
+                           const Span<EdgeCandidate> candidates,
+                           const Span<int> unique_counts,
+                           const OrderedEdge edge)
 {
-  /* Don't use parallelization when the mesh is small. */
-  if (mesh.faces_num < 1000) {
-    return 1;
-  }
-  /* Use at most 8 separate hash tables. Using more threads has diminishing returns. These threads
-   * are better off doing something more useful instead. */
-  const int system_thread_count = BLI_system_thread_count();
-  return power_of_2_min_i(std::min(8, system_thread_count));
+  const IndexRange group = candidate_offsets[edge.v_low].take_front(unique_counts[edge.v_low]);
+  const Span<EdgeCandidate> group_candidates = candidates.slice(group);
+  const EdgeCandidate *found = std::lower_bound(
+      group_candidates.begin(),
+      group_candidates.end(),
+      edge.v_high,
+      [](const EdgeCandidate &candidate, const int v_high) { return candidate.v_high < v_high; });
+  BLI_assert(found != group_candidates.end() && found->v_high == edge.v_high);
+  return found->index;
 }
 
-static void clear_hash_tables(MutableSpan<EdgeMap> edge_maps)
+static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
+                                              const Span<int> corner_verts,
+                                              const OffsetIndices<int> candidate_offsets,
+                                              const Span<EdgeCandidate> candidates,
+                                              const Span<int> unique_counts,
+                                              MutableSpan<int> corner_edges)
 {
-  threading::parallel_for_each(edge_maps, [](EdgeMap &edge_map) { edge_map.clear(); });
+  threading::parallel_for(faces.index_range(), 1024, [&](IndexRange range) {
+    for (const int face_index : range) {
+      const IndexRange face = faces[face_index];
+      /* Corners of invalid edges are not visited. Normally this does not happen in Blender, but it
+       * can be part of an imported mesh with invalid geometry. See #76514. */
+      corner_edges.slice(face).fill(0);
+      foreach_face_edge(
+          face,
+          corner_verts,
+          [&](const int corner, const int /*corner_next*/, const OrderedEdge edge) {
+            corner_edges[corner] = edge_index_find(
+                candidate_offsets, candidates, unique_counts, edge);
+          });
+    }
+  });
 }
 
-static void deselect_known_edges(const OffsetIndices<int> edge_offsets,
-                                 const Span<EdgeMap> edge_maps,
-                                 const uint32_t parallel_mask,
+static void deselect_known_edges(const OffsetIndices<int> candidate_offsets,
+                                 const Span<EdgeCandidate> candidates,
+                                 const Span<int> unique_counts,
                                  const Span<int2> known_edges,
                                  MutableSpan<bool> selection)
 {
   threading::parallel_for(known_edges.index_range(), 2048, [&](const IndexRange range) {
     for (const int2 original_edge : known_edges.slice(range)) {
-      const OrderedEdge ordered_edge(original_edge);
-      const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-      const EdgeMap &edge_map = edge_maps[task_index];
-      const int edge_i = edge_map.index_of(ordered_edge);
-      const int edge_index = edge_offsets[task_index][edge_i];
+      const int edge_index = edge_index_find(
+          candidate_offsets, candidates, unique_counts, OrderedEdge(original_edge));
       selection[edge_index] = false;
     }
   });
@@ -177,37 +240,34 @@ static void deselect_known_edges(const OffsetIndices<int> edge_offsets,
 
 void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new_edges)
 {
-  /* Parallelization is achieved by having multiple hash tables for different subsets of edges.
-   * Each edge is assigned to one of the hash maps based on the lower bits of a hash value. */
-  const int parallel_maps = calc_edges::get_parallel_maps_count(mesh);
-  BLI_assert(is_power_of_2_i(parallel_maps));
-  const uint32_t parallel_mask = uint32_t(parallel_maps) - 1;
-  Array<calc_edges::EdgeMap> edge_maps(parallel_maps);
-  calc_edges::reserve_hash_maps(mesh, keep_existing_edges, edge_maps);
-
-  /* Add all edges. */
-  if (keep_existing_edges) {
-    calc_edges::add_existing_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
-  }
-  calc_edges::add_face_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int2> existing_edges = keep_existing_edges ? mesh.edges() : Span<int2>();
 
-  Array<int> edge_sizes(edge_maps.size() + 1);
-  for (const int i : edge_maps.index_range()) {
-    edge_sizes[i] = edge_maps[i].size();
-  }
-  const OffsetIndices<int> edge_offsets = offset_indices::accumulate_counts_to_offsets(edge_sizes);
+  /* Collect all edge candidates, grouped by their lower vertex. */
+  Array<int> candidate_offsets_data(mesh.verts_num + 1, 0);
+  calc_edges::count_edge_candidates(faces, corner_verts, existing_edges, candidate_offsets_data);
+  const OffsetIndices<int> candidate_offsets = offset_indices::accumulate_counts_to_offsets(
+      candidate_offsets_data);
+  Array<calc_edges::EdgeCandidate> candidates(candidate_offsets.total_size());
+  calc_edges::gather_edge_candidates(
+      faces, corner_verts, existing_edges, candidate_offsets, candidates);
+
+  Array<int> unique_counts(mesh.verts_num);
+  calc_edges::deduplicate_edge_candidates(candidate_offsets, candidates, unique_counts);
+  const int edges_num = calc_edges::assign_edge_indices(
+      candidate_offsets, unique_counts, existing_edges.size() + corner_verts.size(), candidates);
 
   /* Create new edges. */
   MutableAttributeAccessor attributes = mesh.attributes_for_write();
   attributes.add<int>(".corner_edge", AttrDomain::Corner, AttributeInitConstruct());
-  MutableSpan<int2> new_edges(MEM_calloc_arrayN<int2>(edge_offsets.total_size(), __func__),
-                              edge_offsets.total_size());
-  calc_edges::serialize_and_initialize_deduplicated_edges(edge_maps, edge_offsets, new_edges);
-  calc_edges::update_edge_indices_in_face_loops(mesh.faces(),
-                                                mesh.corner_verts(),
-                                                edge_maps,
-                                                parallel_mask,
-                                                edge_offsets,
+  MutableSpan<int2> new_edges(MEM_malloc_arrayN<int2>(edges_num, __func__), edges_num);
+  calc_edges::build_edges(candidate_offsets, candidates, unique_counts, new_edges);
+  calc_edges::update_edge_indices_in_face_loops(faces,
+                                                corner_verts,
+                                                candidate_offsets,
+                                                candidates,
+                                                unique_counts,
                                                 mesh.corner_edges_for_write());
 
   Array<int2> original_edges;
@@ -219,7 +279,7 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   /* Free old CustomData and assign new one. */
   CustomData_free(&mesh.edge_data);
   CustomData_reset(&mesh.edge_data);
-  mesh.edges_num = edge_offsets.total_size();
+  mesh.edges_num = edges_num;
   attributes.add<int2>(".edge_verts", AttrDomain::Edge, AttributeInitMoveArray(new_edges.data()));
 
   if (select_new_edges) {
@@ -230,7 +290,7 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
       select_edge.span.fill(true);
       if (!original_edges.is_empty()) {
         calc_edges::deselect_known_edges(
-            edge_offsets, edge_maps, parallel_mask, original_edges, select_edge.span);
+            candidate_offsets, candidates, unique_counts, original_edges, select_edge.span);
       }
       select_edge.finish();
     }
@@ -240,9 +300,6 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
     /* All edges are rebuilt from the faces, so there are no loose edges. */
     mesh.tag_loose_edges_none();
   }
-
-  /* Explicitly clear edge maps, because that way it can be parallelized. */
-  calc_edges::clear_hash_tables(edge_maps);
 }
 
 }  // namespace blender::bke
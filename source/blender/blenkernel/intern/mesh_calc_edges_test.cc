@@ -0,0 +1,133 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_ordered_edge.hh"
+#include "BLI_vector_set.hh"
+
+#include "BKE_attribute.hh"
+#include "BKE_customdata.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.h"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+namespace blender::bke::tests {
+
+class MeshCalcEdgesTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+};
+
+/** A grid of quads in the XY plane with `size` by `size` faces. */
+static Mesh *create_grid_faces(const int size)
+{
+  const int verts_x = size + 1;
+  Mesh *mesh = BKE_mesh_new_nomain(verts_x * verts_x, 0, size * size, size * size * 4);
+  MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  for (const int y : IndexRange(size)) {
+    for (const int x : IndexRange(size)) {
+      const int face = y * size + x;
+      face_offsets[face] = face * 4;
+      corner_verts[face * 4 + 0] = y * verts_x + x;
+      corner_verts[face * 4 + 1] = y * verts_x + x + 1;
+      corner_verts[face * 4 + 2] = (y + 1) * verts_x + x + 1;
+      corner_verts[face * 4 + 3] = (y + 1) * verts_x + x;
+    }
+  }
+  face_offsets.last() = size * size * 4;
+  return mesh;
+}
+
+/** The edges in the order they are first used by the existing edges and the face corners. */
+static Vector<int2> first_occurrence_edges(const Mesh &mesh, const Span<int2> existing_edges)
+{
+  VectorSet<OrderedEdge> edges;
+  for (const int2 edge : existing_edges) {
+    edges.add(OrderedEdge(edge));
+  }
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  for (const int face : faces.index_range()) {
+    for (const int corner : faces[face]) {
+      const int corner_prev = mesh::face_corner_prev(faces[face], corner);
+      edges.add(OrderedEdge(corner_verts[corner_prev], corner_verts[corner]));
+    }
+  }
+  Vector<int2> result;
+  for (const OrderedEdge &edge : edges) {
+    result.append(int2(edge.v_low, edge.v_high));
+  }
+  return result;
+}
+
+static void expect_valid_corner_edges(const Mesh &mesh)
+{
+  const Span<int2> edges = mesh.edges();
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int> corner_edges = mesh.corner_edges();
+  for (const int face : faces.index_range()) {
+    for (const int corner : faces[face]) {
+      const int corner_next = mesh::face_corner_next(faces[face], corner);
+      EXPECT_EQ(OrderedEdge(edges[corner_edges[corner]]),
+                OrderedEdge(corner_verts[corner], corner_verts[corner_next]));
+    }
+  }
+}
+
+TEST_F(MeshCalcEdgesTest, SingleQuadOrder)
+{
+  Mesh *mesh = create_grid_faces(1);
+  mesh_calc_edges(*mesh, false, false);
+  const Vector<int2> expected = {int2(0, 2), int2(0, 1), int2(1, 3), int2(2, 3)};
+  EXPECT_EQ_SPAN<int2>(expected, mesh->edges());
+  expect_valid_corner_edges(*mesh);
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(MeshCalcEdgesTest, KeepExistingEdgesFirst)
+{
+  Mesh *mesh = create_grid_faces(1);
+  /* An edge that is also used by the face, in reversed direction, and a loose edge. */
+  const Vector<int2> existing_edges = {int2(3, 1), int2(0, 3)};
+  CustomData_free(&mesh->edge_data);
+  CustomData_reset(&mesh->edge_data);
+  mesh->edges_num = existing_edges.size();
+  mesh->attributes_for_write().add<int2>(
+      ".edge_verts", AttrDomain::Edge, AttributeInitConstruct());
+  mesh->edges_for_write().copy_from(existing_edges);
+
+  mesh_calc_edges(*mesh, true, true);
+  const Vector<int2> expected = {int2(1, 3), int2(0, 3), int2(0, 2), int2(0, 1), int2(2, 3)};
+  EXPECT_EQ_SPAN<int2>(expected, mesh->edges());
+  EXPECT_EQ_SPAN<int2>(first_occurrence_edges(*mesh, existing_edges), mesh->edges());
+  expect_valid_corner_edges(*mesh);
+
+  const VArraySpan<bool> select_edge = *mesh->attributes().lookup<bool>(".select_edge",
+                                                                         AttrDomain::Edge);
+  const Vector<bool> expected_selection = {false, false, true, true, true};
+  EXPECT_EQ_SPAN<bool>(expected_selection, select_edge);
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(MeshCalcEdgesTest, LargeMeshFirstOccurrenceOrder)
+{
+  /* Large enough to be split into many tasks. */
+  Mesh *mesh = create_grid_faces(100);
+  mesh_calc_edges(*mesh, false, false);
+  const Vector<int2> expected = first_occurrence_edges(*mesh, {});
+  EXPECT_EQ_SPAN<int2>(expected, mesh->edges());
+  expect_valid_corner_edges(*mesh);
+  BKE_id_free(nullptr, mesh);
+}
+
+}  // namespace blender::bke::tests
@@ -1167,6 +1167,56 @@ static float3 accumulate_fan_normal(const Span<VertCornerInfo> corner_infos,
   return math::normalize(fan_normal);
 }
 
+/**
+ * Fan spaces computed by a single task. They are added to the shared #CornerNormalSpaceArray all
+ * at once, to avoid locking its mutex for every fan.
+ */
+struct LocalFanSpaces {
+  Vector<CornerNormalSpace> spaces;
+  /** The corners of all spaces, grouped by #offsets. */
+  Vector<int> corners;
+  Vector<int> offsets = {0};
+};
+
+static void add_local_fan_spaces(LocalFanSpaces &local_spaces,
+                                 CornerNormalSpaceArray &r_fan_spaces)
+{
+  if (local_spaces.spaces.is_empty()) {
+    return;
+  }
+  const OffsetIndices<int> offsets(local_spaces.offsets.as_span());
+  Vector<Array<int>> corners_by_space;
+  if (r_fan_spaces.create_corners_by_space) {
+    corners_by_space.reserve(offsets.size());
+    for (const int i : offsets.index_range()) {
+      corners_by_space.append(Array<int>(local_spaces.corners.as_span().slice(offsets[i])));
+    }
+  }
+
+  int start_index;
+  {
+    std::lock_guard lock(r_fan_spaces.build_mutex);
+    start_index = r_fan_spaces.spaces.size();
+    r_fan_spaces.spaces.extend(local_spaces.spaces.as_span());
+    if (r_fan_spaces.create_corners_by_space) {
+      for (Array<int> &corners : corners_by_space) {
+        r_fan_spaces.corners_by_space.append(std::move(corners));
+      }
+    }
+  }
+
+  /* Every corner is part of only one fan, so this doesn't have to be protected by the lock. */
+  MutableSpan<int> corner_space_indices = r_fan_spaces.corner_space_indices;
+  for (const int i : offsets.index_range()) {
+    corner_space_indices.fill_indices(local_spaces.corners.as_span().slice(offsets[i]),
+                                      start_index + i);
+  }
+
+  local_spaces.spaces.clear();
+  local_spaces.corners.clear();
+  local_spaces.offsets.resize(1);
+}
+
 /* Don't inline this function to simplify the code path without custom normals.*/
 BLI_NOINLINE static void handle_fan_result_and_custom_normals(
     const Span<short2> custom_normals,
@@ -1174,7 +1224,7 @@ BLI_NOINLINE static void handle_fan_result_and_custom_normals(
     const Span<float3> edge_dirs,
     const Span<int> local_corners_in_fan,
     float3 &fan_normal,
-    CornerNormalSpaceArray *r_fan_spaces)
+    LocalFanSpaces *r_local_spaces)
 {
   const int local_edge_first = corner_infos[local_corners_in_fan.first()].local_edge_next;
   const int local_edge_last = corner_infos[local_corners_in_fan.last()].local_edge_prev;
@@ -1204,22 +1254,13 @@ BLI_NOINLINE static void handle_fan_result_and_custom_normals(
     fan_normal = corner_space_custom_data_to_normal(fan_space, short2(average_custom_normal));
   }
 
-  if (r_fan_spaces) {
-    std::lock_guard lock(r_fan_spaces->build_mutex);
-    r_fan_spaces->spaces.append(fan_space);
-    const int fan_space_index = r_fan_spaces->spaces.size() - 1;
+  if (r_local_spaces) {
+    r_local_spaces->spaces.append(fan_space);
     for (const int local_corner : local_corners_in_fan) {
       const VertCornerInfo &info = corner_infos[local_corner];
-      r_fan_spaces->corner_space_indices[info.corner] = fan_space_index;
-    }
-    if (r_fan_spaces->create_corners_by_space) {
-      Array<int> corners_in_space(local_corners_in_fan.size());
-      for (const int i : local_corners_in_fan.index_range()) {
-        const VertCornerInfo &info = corner_infos[local_corners_in_fan[i]];
-        corners_in_space[i] = info.corner;
-      }
-      r_fan_spaces->corners_by_space.append(std::move(corners_in_space));
+      r_local_spaces->corners.append(info.corner);
     }
+    r_local_spaces->offsets.append(r_local_spaces->corners.size());
   }
 }
 
@@ -1250,6 +1291,7 @@ void normals_calc_corners(const Span<float3> vert_positions,
     Vector<float3, 16> edge_dirs;
     Vector<bool, 16> local_corner_visited;
     Vector<int, 16> corners_in_fan;
+    LocalFanSpaces local_spaces;
     for (const int vert : range) {
       const float3 vert_position = vert_positions[vert];
       const Span<int> vert_faces = vert_to_face_map[vert];
@@ -1291,8 +1333,12 @@ void normals_calc_corners(const Span<float3> vert_positions,
             corner_infos, edge_dirs, face_normals, corners_in_fan);
 
         if (!custom_normals.is_empty() || r_fan_spaces) {
-          handle_fan_result_and_custom_normals(
-              custom_normals, corner_infos, edge_dirs, corners_in_fan, fan_normal, r_fan_spaces);
+          handle_fan_result_and_custom_normals(custom_normals,
+                                               corner_infos,
+                                               edge_dirs,
+                                               corners_in_fan,
+                                               fan_normal,
+                                               r_fan_spaces ? &local_spaces : nullptr);
         }
 
         for (const int local_corner : corners_in_fan) {
@@ -1309,6 +1355,9 @@ void normals_calc_corners(const Span<float3> vert_positions,
       }
       BLI_assert(visited_count == corner_infos.size());
     }
+    if (r_fan_spaces) {
+      add_local_fan_spaces(local_spaces, *r_fan_spaces);
+    }
   });
 }
 
@@ -24,6 +24,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_modifier_enums.h"
@@ -445,6 +446,90 @@ struct IslandResult {
 /* Will be enough in 99% of cases. */
 #define MREMAP_DEFAULT_BUFSIZE 32
 
+/** The nearest query of a vertex starts from the result of the previous one in the same block. */
+#define MREMAP_NEAREST_BLOCK_SIZE 1024
+
+/**
+ * Run the nearest queries of all destination vertices in parallel, vertices without a source
+ * within \a max_dist_sq get an index of -1. Only the queries are threaded, defining the map items
+ * allocates from the map's arena. The proximity heuristic of #mesh_remap_bvhtree_query_nearest
+ * restarts at every block of a fixed size, so the result doesn't depend on the threading.
+ */
+static void mesh_remap_verts_query_nearest(blender::bke::BVHTreeFromMesh *treedata,
+                                           const SpaceTransform *space_transform,
+                                           const float (*vert_positions_dst)[3],
+                                           const int numverts_dst,
+                                           const float max_dist_sq,
+                                           blender::MutableSpan<BVHTreeNearest> r_nearest,
+                                           blender::MutableSpan<float> r_hit_dist)
+{
+  const int64_t blocks_num = int64_t(
+      divide_ceil_ul(uint64_t(numverts_dst), uint64_t(MREMAP_NEAREST_BLOCK_SIZE)));
+  blender::threading::parallel_for(
+      blender::IndexRange(blocks_num), 1, [&](const blender::IndexRange range) {
+        for (const int64_t block : range) {
+          BVHTreeNearest nearest = {0};
+          nearest.index = -1;
+          const blender::IndexRange verts = blender::IndexRange::from_begin_end(
+              block * MREMAP_NEAREST_BLOCK_SIZE,
+              std::min<int64_t>((block + 1) * MREMAP_NEAREST_BLOCK_SIZE, numverts_dst));
+          for (const int64_t i : verts) {
+            float tmp_co[3];
+            copy_v3_v3(tmp_co, vert_positions_dst[i]);
+
+            /* Convert the vertex to tree coordinates, if needed. */
+            if (space_transform) {
+              BLI_space_transform_apply(space_transform, tmp_co);
+            }
+
+            if (mesh_remap_bvhtree_query_nearest(
+                    treedata, &nearest, tmp_co, max_dist_sq, &r_hit_dist[i]))
+            {
+              r_nearest[i] = nearest;
+            }
+            else {
+              r_nearest[i].index = -1;
+            }
+          }
+        }
+      });
+}
+
+/**
+ * Threaded version of #mesh_remap_bvhtree_query_raycast along the normals of all destination
+ * vertices, vertices without a hit get an index of -1.
+ */
+static void mesh_remap_verts_query_raycast(blender::bke::BVHTreeFromMesh *treedata,
+                                           const SpaceTransform *space_transform,
+                                           const float (*vert_positions_dst)[3],
+                                           const blender::Span<blender::float3> vert_normals_dst,
+                                           const float ray_radius,
+                                           const float max_dist,
+                                           blender::MutableSpan<BVHTreeRayHit> r_rayhit,
+                                           blender::MutableSpan<float> r_hit_dist)
+{
+  blender::threading::parallel_for(
+      r_rayhit.index_range(), 256, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          float tmp_co[3], tmp_no[3];
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+          copy_v3_v3(tmp_no, vert_normals_dst[i]);
+
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+            BLI_space_transform_apply_normal(space_transform, tmp_no);
+          }
+
+          if (!mesh_remap_bvhtree_query_raycast(
+                  treedata, &r_rayhit[i], tmp_co, tmp_no, ray_radius, max_dist, &r_hit_dist[i]))
+          {
+            r_rayhit[i].index = -1;
+          }
+        }
+      });
+}
+
 void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -471,26 +556,25 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
   }
   else {
     blender::bke::BVHTreeFromMesh treedata{};
-    BVHTreeNearest nearest = {0};
-    BVHTreeRayHit rayhit = {0};
-    float hit_dist;
-    float tmp_co[3], tmp_no[3];
+    blender::Array<BVHTreeNearest> nearest_dst;
+    blender::Array<float> hit_dist_dst(numverts_dst);
+    float tmp_co[3];
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       treedata = me_src->bvh_verts();
-      nearest.index = -1;
+      nearest_dst.reinitialize(numverts_dst);
+      mesh_remap_verts_query_nearest(&treedata,
+                                     space_transform,
+                                     vert_positions_dst,
+                                     numverts_dst,
+                                     max_dist_sq,
+                                     nearest_dst,
+                                     hit_dist_dst);
 
       for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+        if (nearest_dst[i].index != -1) {
+          mesh_remap_item_define(
+              r_map, i, hit_dist_dst[i], 0, 1, &nearest_dst[i].index, &full_weight);
         }
         else {
           /* No source for this dest vertex! */
@@ -503,19 +587,26 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       treedata = me_src->bvh_edges();
-      nearest.index = -1;
+      nearest_dst.reinitialize(numverts_dst);
+      mesh_remap_verts_query_nearest(&treedata,
+                                     space_transform,
+                                     vert_positions_dst,
+                                     numverts_dst,
+                                     max_dist_sq,
+                                     nearest_dst,
+                                     hit_dist_dst);
 
       for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+        if (nearest_dst[i].index != -1) {
+          const float hit_dist = hit_dist_dst[i];
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+          }
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const blender::int2 &edge = edges_src[nearest.index];
+          const blender::int2 &edge = edges_src[nearest_dst[i].index];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
 
@@ -565,19 +656,19 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       treedata = me_src->bvh_corner_tris();
 
       if (mode == MREMAP_MODE_VERT_POLYINTERP_VNORPROJ) {
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
-          copy_v3_v3(tmp_no, vert_normals_dst[i]);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-            BLI_space_transform_apply_normal(space_transform, tmp_no);
-          }
+        blender::Array<BVHTreeRayHit> rayhit_dst(numverts_dst);
+        mesh_remap_verts_query_raycast(&treedata,
+                                       space_transform,
+                                       vert_positions_dst,
+                                       vert_normals_dst,
+                                       ray_radius,
+                                       max_dist,
+                                       rayhit_dst,
+                                       hit_dist_dst);
 
-          if (mesh_remap_bvhtree_query_raycast(
-                  &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
-          {
+        for (i = 0; i < numverts_dst; i++) {
+          const BVHTreeRayHit &rayhit = rayhit_dst[i];
+          if (rayhit.index != -1) {
             const int face_index = tri_faces[rayhit.index];
             const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
                                                                     corner_verts_src,
@@ -591,7 +682,8 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                                                     true,
                                                                     nullptr);
 
-            mesh_remap_item_define(r_map, i, hit_dist, 0, sources_num, indices, weights);
+            mesh_remap_item_define(
+                r_map, i, hit_dist_dst[i], 0, sources_num, indices, weights);
           }
           else {
             /* No source for this dest vertex! */
@@ -600,19 +692,19 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
         }
       }
       else {
-        nearest.index = -1;
+        nearest_dst.reinitialize(numverts_dst);
+        mesh_remap_verts_query_nearest(&treedata,
+                                       space_transform,
+                                       vert_positions_dst,
+                                       numverts_dst,
+                                       max_dist_sq,
+                                       nearest_dst,
+                                       hit_dist_dst);
 
         for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-          }
-
-          if (mesh_remap_bvhtree_query_nearest(
-                  &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-          {
+          const BVHTreeNearest &nearest = nearest_dst[i];
+          if (nearest.index != -1) {
+            const float hit_dist = hit_dist_dst[i];
             const int face_index = tri_faces[nearest.index];
 
             if (mode == MREMAP_MODE_VERT_FACE_NEAREST) {
@@ -14,6 +14,7 @@
 
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_mesh.hh"
 #include "BKE_multires.hh"
@@ -58,73 +59,71 @@ static float v3_dist_from_plane(const float v[3], const float center[3], const f
 
 void multires_reshape_apply_base_refit_base_mesh(MultiresReshapeContext *reshape_context)
 {
+  using namespace blender;
   Mesh *base_mesh = reshape_context->base_mesh;
   blender::MutableSpan<blender::float3> base_positions = base_mesh->vert_positions_for_write();
   /* Update the context in case the vertices were duplicated. */
   reshape_context->base_positions = base_positions;
   const blender::GroupedSpan<int> vert_to_face_map = base_mesh->vert_to_face_map();
 
-  float(*origco)[3] = MEM_calloc_arrayN<float[3]>(base_mesh->verts_num, __func__);
-  for (int i = 0; i < base_mesh->verts_num; i++) {
-    copy_v3_v3(origco[i], base_positions[i]);
-  }
+  const blender::Array<blender::float3> origco(base_positions.as_span());
 
-  for (int i = 0; i < base_mesh->verts_num; i++) {
-    float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
+  threading::parallel_for(base_positions.index_range(), 512, [&](const IndexRange range) {
+    for (const int i : range) {
+      float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
 
-    /* Don't adjust vertices not used by at least one face. */
-    if (!vert_to_face_map[i].size()) {
-      continue;
-    }
+      /* Don't adjust vertices not used by at least one face. */
+      if (!vert_to_face_map[i].size()) {
+        continue;
+      }
 
-    /* Find center. */
-    int tot = 0;
-    for (const int face : vert_to_face_map[i]) {
-      /* This double counts, not sure if that's bad or good. */
-      for (const int corner : reshape_context->base_faces[face]) {
-        const int vndx = reshape_context->base_corner_verts[corner];
-        if (vndx != i) {
-          add_v3_v3(center, origco[vndx]);
-          tot++;
+      /* Find center. */
+      int tot = 0;
+      for (const int face : vert_to_face_map[i]) {
+        /* This double counts, not sure if that's bad or good. */
+        for (const int corner : reshape_context->base_faces[face]) {
+          const int vndx = reshape_context->base_corner_verts[corner];
+          if (vndx != i) {
+            add_v3_v3(center, origco[vndx]);
+            tot++;
+          }
         }
       }
-    }
-    mul_v3_fl(center, 1.0f / tot);
+      mul_v3_fl(center, 1.0f / tot);
 
-    /* Find normal. */
-    for (int j = 0; j < vert_to_face_map[i].size(); j++) {
-      const blender::IndexRange face = reshape_context->base_faces[vert_to_face_map[i][j]];
+      /* Find normal. */
+      for (int j = 0; j < vert_to_face_map[i].size(); j++) {
+        const blender::IndexRange face = reshape_context->base_faces[vert_to_face_map[i][j]];
 
-      /* Set up face, loops, and coords in order to call #bke::mesh::face_normal_calc(). */
-      blender::Array<int> face_verts(face.size());
-      blender::Array<blender::float3> fake_co(face.size());
+        /* Set up face, loops, and coords in order to call #bke::mesh::face_normal_calc(). */
+        blender::Array<int> face_verts(face.size());
+        blender::Array<blender::float3> fake_co(face.size());
 
-      for (int k = 0; k < face.size(); k++) {
-        const int vndx = reshape_context->base_corner_verts[face[k]];
+        for (int k = 0; k < face.size(); k++) {
+          const int vndx = reshape_context->base_corner_verts[face[k]];
 
-        face_verts[k] = k;
+          face_verts[k] = k;
 
-        if (vndx == i) {
-          copy_v3_v3(fake_co[k], center);
-        }
-        else {
-          copy_v3_v3(fake_co[k], origco[vndx]);
+          if (vndx == i) {
+            copy_v3_v3(fake_co[k], center);
+          }
+          else {
+            copy_v3_v3(fake_co[k], origco[vndx]);
+          }
         }
+
+        const blender::float3 no = blender::bke::mesh::face_normal_calc(fake_co, face_verts);
+        add_v3_v3(avg_no, no);
       }
+      normalize_v3(avg_no);
 
-      const blender::float3 no = blender::bke::mesh::face_normal_calc(fake_co, face_verts);
-      add_v3_v3(avg_no, no);
+      /* Push vertex away from the plane. */
+      const float dist = v3_dist_from_plane(base_positions[i], center, avg_no);
+      copy_v3_v3(push, avg_no);
+      mul_v3_fl(push, dist);
+      add_v3_v3(base_positions[i], push);
     }
-    normalize_v3(avg_no);
-
-    /* Push vertex away from the plane. */
-    const float dist = v3_dist_from_plane(base_positions[i], center, avg_no);
-    copy_v3_v3(push, avg_no);
-    mul_v3_fl(push, dist);
-    add_v3_v3(base_positions[i], push);
-  }
-
-  MEM_freeN(origco);
+  });
 
   /* Vertices were moved around, need to update normals after all the vertices are updated
    * Probably this is possible to do in the loop above, but this is rather tricky because
@@ -186,7 +186,8 @@ float BKE_ocean_jminus_to_foam(float jminus, float coverage)
   return foam;
 }
 
-void BKE_ocean_eval_uv(Ocean *oc, OceanResult *ocr, float u, float v)
+/** Same as #BKE_ocean_eval_uv, but expects the ocean to be locked for reading already. */
+static void ocean_eval_uv_locked(Ocean *oc, OceanResult *ocr, float u, float v)
 {
   int i0, i1, j0, j1;
   float frac_x, frac_z;
@@ -203,8 +204,6 @@ void BKE_ocean_eval_uv(Ocean *oc, OceanResult *ocr, float u, float v)
     v += 1.0f;
   }
 
-  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
-
   uu = u * oc->_M;
   vv = v * oc->_N;
 
@@ -253,7 +252,21 @@ void BKE_ocean_eval_uv(Ocean *oc, OceanResult *ocr, float u, float v)
     }
   }
 #  undef BILERP
+}
+
+void BKE_ocean_eval_uv(Ocean *oc, OceanResult *ocr, float u, float v)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  ocean_eval_uv_locked(oc, ocr, u, v);
+  BLI_rw_mutex_unlock(&oc->oceanmutex);
+}
 
+void BKE_ocean_eval_uv_n(Ocean *oc, OceanResult *r_ocr, const float (*uvs)[2], const int uvs_num)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  for (int i = 0; i < uvs_num; i++) {
+    ocean_eval_uv_locked(oc, &r_ocr[i], uvs[i][0], uvs[i][1]);
+  }
   BLI_rw_mutex_unlock(&oc->oceanmutex);
 }
 
@@ -1557,6 +1570,13 @@ float BKE_ocean_jminus_to_foam(float /*jminus*/, float /*coverage*/)
 
 void BKE_ocean_eval_uv(Ocean * /*oc*/, OceanResult * /*ocr*/, float /*u*/, float /*v*/) {}
 
+void BKE_ocean_eval_uv_n(Ocean * /*oc*/,
+                         OceanResult * /*r_ocr*/,
+                         const float (* /*uvs*/)[2],
+                         const int /*uvs_num*/)
+{
+}
+
 /* use catmullrom interpolation rather than linear */
 void BKE_ocean_eval_uv_catrom(Ocean * /*oc*/, OceanResult * /*ocr*/, float /*u*/, float /*v*/) {}
 
@@ -45,6 +45,7 @@
 #include "BLI_rand.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -1032,7 +1033,6 @@ void psys_free(Object *ob, ParticleSystem *psys)
 
     BLI_freelistN(&psys->targets);
 
-    BLI_bvhtree_free(psys->bvhtree);
     BLI_kdtree_3d_free(psys->tree);
 
     if (psys->fluid_springs) {
@@ -3129,9 +3129,8 @@ static void psys_thread_create_path(ParticleTask *task,
   }
 }
 
-static void exec_child_path_cache(TaskPool *__restrict /*pool*/, void *taskdata)
+static void exec_child_path_cache(ParticleTask *task)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
   ParticleThreadContext *ctx = task->ctx;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleCacheKey **cache = psys->childcache;
@@ -3160,7 +3159,6 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     return;
   }
 
-  TaskPool *task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
   const int totchild = ctx.totchild;
   const int totparent = ctx.totparent;
 
@@ -3181,20 +3179,18 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
   blender::Vector<ParticleTask> tasks_parent = psys_tasks_create(&ctx, 0, totparent);
   for (ParticleTask &task : tasks_parent) {
     psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
   }
-  BLI_task_pool_work_and_wait(task_pool);
+  blender::threading::parallel_for_each(
+      tasks_parent, [](ParticleTask &task) { exec_child_path_cache(&task); });
 
   /* cache child paths */
   ctx.parent_pass = 0;
   blender::Vector<ParticleTask> tasks_child = psys_tasks_create(&ctx, totparent, totchild);
   for (ParticleTask &task : tasks_child) {
     psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
   }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
+  blender::threading::parallel_for_each(
+      tasks_child, [](ParticleTask &task) { exec_child_path_cache(&task); });
 
   psys_tasks_free(tasks_parent);
   psys_tasks_free(tasks_child);
@@ -5422,7 +5418,6 @@ void BKE_particle_system_blend_read_data(BlendDataReader *reader, ListBase *part
     }
 
     psys->tree = nullptr;
-    psys->bvhtree = nullptr;
 
     psys->orig_psys = nullptr;
     psys->batch_cache = nullptr;
@@ -16,7 +16,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_rand.h"
 #include "BLI_sort.h"
-#include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -778,9 +778,8 @@ static void distribute_children_exec(ParticleTask *thread, ChildParticle *cpa, i
   }
 }
 
-static void exec_distribute_parent(TaskPool *__restrict /*pool*/, void *taskdata)
+static void exec_distribute_parent(ParticleTask *task)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
   ParticleSystem *psys = task->ctx->sim.psys;
   ParticleData *pa;
   int p;
@@ -807,20 +806,17 @@ static void exec_distribute_parent(TaskPool *__restrict /*pool*/, void *taskdata
   }
 }
 
-static void exec_distribute_child(TaskPool *__restrict /*pool*/, void *taskdata)
+static void exec_distribute_child(ParticleTask *task)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
   ParticleSystem *psys = task->ctx->sim.psys;
   ChildParticle *cpa;
   int p;
 
   /* RNG skipping at the beginning */
-  cpa = psys->child;
-  for (p = 0; p < task->begin; p++, cpa++) {
-    BLI_rng_skip(task->rng, PSYS_RND_DIST_SKIP);
-  }
+  BLI_rng_skip(task->rng, PSYS_RND_DIST_SKIP * task->begin);
 
-  for (; p < task->end; p++, cpa++) {
+  cpa = psys->child + task->begin;
+  for (p = task->begin; p < task->end; p++, cpa++) {
     distribute_children_exec(task, cpa, p);
   }
 }
@@ -1343,22 +1339,19 @@ static void distribute_particles_on_dm(ParticleSimulationData *sim, int from)
     return;
   }
 
-  TaskPool *task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
-
   const int totpart = (from == PART_FROM_CHILD ? sim->psys->totchild : sim->psys->totpart);
   blender::Vector<ParticleTask> tasks = psys_tasks_create(&ctx, 0, totpart);
   for (ParticleTask &task : tasks) {
     psys_task_init_distribute(&task, sim);
+  }
+  blender::threading::parallel_for_each(tasks, [&](ParticleTask &task) {
     if (from == PART_FROM_CHILD) {
-      BLI_task_pool_push(task_pool, exec_distribute_child, &task, false, nullptr);
+      exec_distribute_child(&task);
     }
     else {
-      BLI_task_pool_push(task_pool, exec_distribute_parent, &task, false, nullptr);
+      exec_distribute_parent(&task);
     }
-  }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
+  });
 
   psys_calc_dmcache(sim->ob, final_mesh, sim->psmd->mesh_original, sim->psys);
 
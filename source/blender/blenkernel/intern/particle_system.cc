@@ -27,6 +27,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_texture_types.h"
 
+#include "BLI_index_mask.hh"
 #include "BLI_kdopbvh.hh"
 #include "BLI_kdtree.h"
 #include "BLI_linklist.h"
@@ -39,6 +40,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -70,8 +72,6 @@
 #  include "manta_fluid_API.h"
 #endif  // WITH_FLUID
 
-static ThreadRWMutex psys_bvhtree_rwlock = BLI_RWLOCK_INITIALIZER;
-
 /************************************************/
 /*          Reacting to system events           */
 /************************************************/
@@ -1299,60 +1299,10 @@ void psys_get_pointcache_start_end(Scene *scene, ParticleSystem *psys, int *sfra
   *efra = min_ii(int(part->end + part->lifetime + 1.0f), max_ii(scene->r.pefra, scene->r.efra));
 }
 
-/* BVH tree balancing inside a mutex lock must be run in isolation. Balancing
- * is multithreaded, and we do not want the current thread to start another task
- * that may involve acquiring the same mutex lock that it is waiting for. */
-static void bvhtree_balance_isolated(void *userdata)
-{
-  BLI_bvhtree_balance((BVHTree *)userdata);
-}
-
 /************************************************/
 /*          Effectors                           */
 /************************************************/
 
-static void psys_update_particle_bvhtree(ParticleSystem *psys, float cfra)
-{
-  if (psys) {
-    PARTICLE_P;
-    int totpart = 0;
-    bool need_rebuild;
-
-    BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
-    need_rebuild = !psys->bvhtree || psys->bvhtree_frame != cfra;
-    BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
-
-    if (need_rebuild) {
-      LOOP_SHOWN_PARTICLES
-      {
-        totpart++;
-      }
-
-      BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_WRITE);
-
-      BLI_bvhtree_free(psys->bvhtree);
-      psys->bvhtree = BLI_bvhtree_new(totpart, 0.0, 4, 6);
-
-      LOOP_SHOWN_PARTICLES
-      {
-        if (pa->alive == PARS_ALIVE) {
-          if (pa->state.time == cfra) {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->prev_state.co, 1);
-          }
-          else {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->state.co, 1);
-          }
-        }
-      }
-
-      BLI_task_isolate(bvhtree_balance_isolated, psys->bvhtree);
-
-      psys->bvhtree_frame = cfra;
-
-      BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
-    }
-  }
-}
 void psys_update_particle_tree(ParticleSystem *psys, float cfra)
 {
   if (psys) {
@@ -1679,13 +1629,13 @@ struct SPHRangeData {
   int use_size;
 };
 
-static void sph_evaluate_func(BVHTree *tree,
-                              ParticleSystem **psys,
+static void sph_evaluate_func(const SPHData *sphdata,
                               const float co[3],
                               SPHRangeData *pfr,
                               float interaction_radius,
                               BVHTree_RangeQuery callback)
 {
+  ParticleSystem *const *psys = sphdata->psys;
   int i;
 
   pfr->tot_neighbors = 0;
@@ -1695,16 +1645,10 @@ static void sph_evaluate_func(BVHTree *tree,
     pfr->massfac = psys[i]->part->mass / pfr->mass;
     pfr->use_size = psys[i]->part->flag & PART_SIZEMASS;
 
-    if (tree) {
-      BLI_bvhtree_range_query(tree, co, interaction_radius, callback, pfr);
-      break;
-    }
-
-    BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
-
-    BLI_bvhtree_range_query(psys[i]->bvhtree, co, interaction_radius, callback, pfr);
-
-    BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
+    sphdata->neighbor_grids[i].foreach_in_radius(
+        co, interaction_radius, [&](const int index, const float squared_dist) {
+          callback(pfr, index, co, squared_dist);
+        });
   }
 }
 static void sph_density_accum_cb(void *userdata, int index, const float co[3], float squared_dist)
@@ -1824,7 +1768,7 @@ static void sph_force_cb(void *sphdata_v, ParticleKey *state, float *force, floa
   pfr.pa = pa;
   pfr.mass = sphdata->mass;
 
-  sph_evaluate_func(nullptr, psys, state->co, &pfr, interaction_radius, sph_density_accum_cb);
+  sph_evaluate_func(sphdata, state->co, &pfr, interaction_radius, sph_density_accum_cb);
 
   density = data[0];
   near_density = data[1];
@@ -2017,8 +1961,7 @@ static void sphclassical_force_cb(void *sphdata_v,
   pfr.h = h;
   pfr.pa = pa;
 
-  sph_evaluate_func(
-      nullptr, psys, state->co, &pfr, interaction_radius, sphclassical_neighbor_accum_cb);
+  sph_evaluate_func(sphdata, state->co, &pfr, interaction_radius, sphclassical_neighbor_accum_cb);
   pressure = stiffness * (pow7f(pa->sphdensity / rest_density) - 1.0f);
 
   /* Multiply by mass so that we return a force, not acceleration. */
@@ -2102,11 +2045,40 @@ static void sphclassical_calc_dens(ParticleData *pa, float /*dfra*/, SPHData *sp
   pfr.mass = sphdata->mass;
 
   sph_evaluate_func(
-      nullptr, psys, pa->state.co, &pfr, interaction_radius, sphclassical_density_accum_cb);
+      sphdata, pa->state.co, &pfr, interaction_radius, sphclassical_density_accum_cb);
   pa->sphdensity = min_ff(max_ff(data[0], fluid->rest_density * 0.9f), fluid->rest_density * 1.1f);
 }
 
-void psys_sph_init(ParticleSimulationData *sim, SPHData *sphdata)
+/**
+ * Grid of the alive particles of \a psys, at the positions the neighbor search of a step at
+ * \a cfra uses.
+ */
+static blender::SpatialHashGrid sph_neighbor_grid_build(const ParticleSystem *psys,
+                                                        const float cfra,
+                                                        const float interaction_radius)
+{
+  using namespace blender;
+  const Span<ParticleData> particles(psys->particles, psys->totpart);
+  Array<float3> positions(particles.size());
+  threading::parallel_for(particles.index_range(), 4096, [&](const IndexRange range) {
+    for (const int p : range) {
+      const ParticleData &pa = particles[p];
+      positions[p] = float3(pa.state.time == cfra ? pa.prev_state.co : pa.state.co);
+    }
+  });
+  IndexMaskMemory memory;
+  const IndexMask alive = IndexMask::from_predicate(
+      particles.index_range(), GrainSize(4096), memory, [&](const int p) {
+        const ParticleData &pa = particles[p];
+        return !(pa.flag & (PARS_UNEXIST | PARS_NO_DISP)) && pa.alive == PARS_ALIVE;
+      });
+  return SpatialHashGrid(positions, alive, interaction_radius);
+}
+
+void psys_sph_init(ParticleSimulationData *sim,
+                   SPHData *sphdata,
+                   blender::MutableSpan<blender::SpatialHashGrid> neighbor_grids,
+                   const float cfra)
 {
   ParticleTarget *pt;
   int i;
@@ -2121,6 +2093,16 @@ void psys_sph_init(ParticleSimulationData *sim, SPHData *sphdata)
     sphdata->psys[i] = pt ? psys_get_target_system(sim->ob, pt) : nullptr;
   }
 
+  /* Same as the interaction radius used by the solvers. */
+  const ParticleSettings *part = sim->psys->part;
+  const float interaction_radius = part->fluid->radius *
+                                   (part->fluid->flag & SPH_FAC_RADIUS ? 4.0f * part->size : 1.0f);
+  BLI_assert(neighbor_grids.size() == 10);
+  for (i = 0; i < 10 && sphdata->psys[i]; i++) {
+    neighbor_grids[i] = sph_neighbor_grid_build(sphdata->psys[i], cfra, interaction_radius);
+  }
+  sphdata->neighbor_grids = neighbor_grids.data();
+
   if (psys_uses_gravity(sim)) {
     sphdata->gravity = sim->scene->physics_settings.gravity;
   }
@@ -2162,7 +2144,7 @@ void psys_sph_finalize(SPHData *sphdata)
   psys_sph_flush_springs(sphdata);
 }
 
-void psys_sph_density(BVHTree *tree, SPHData *sphdata, float co[3], float vars[2])
+void psys_sph_density(SPHData *sphdata, float co[3], float vars[2])
 {
   ParticleSystem **psys = sphdata->psys;
   SPHFluidSettings *fluid = psys[0]->part->fluid;
@@ -2177,7 +2159,7 @@ void psys_sph_density(BVHTree *tree, SPHData *sphdata, float co[3], float vars[2
   pfr.h = interaction_radius * sphdata->hfac;
   pfr.mass = sphdata->mass;
 
-  sph_evaluate_func(tree, psys, co, &pfr, interaction_radius, sphdata->density_cb);
+  sph_evaluate_func(sphdata, co, &pfr, interaction_radius, sphdata->density_cb);
 
   vars[0] = pfr.data[0];
   vars[1] = pfr.data[1];
@@ -3883,17 +3865,7 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
       break;
     }
     case PART_PHYS_FLUID: {
-      ParticleTarget *pt = static_cast<ParticleTarget *>(psys->targets.first);
-      psys_update_particle_bvhtree(psys, cfra);
-
-      /* Updating others systems particle tree for fluid-fluid interaction. */
-      for (; pt; pt = pt->next) {
-        if (pt->ob) {
-          psys_update_particle_bvhtree(
-              static_cast<ParticleSystem *>(BLI_findlink(&pt->ob->particlesystem, pt->psys - 1)),
-              cfra);
-        }
-      }
+      /* The neighbor grids are built by #psys_sph_init. */
       break;
     }
   }
@@ -3982,8 +3954,9 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
       break;
     }
     case PART_PHYS_FLUID: {
+      blender::Array<blender::SpatialHashGrid> neighbor_grids(10);
       SPHData sphdata;
-      psys_sph_init(sim, &sphdata);
+      psys_sph_init(sim, &sphdata, neighbor_grids, cfra);
 
       DynamicStepSolverTaskData task_data{};
       task_data.sim = sim;
@@ -1118,18 +1118,23 @@ void Tree::flush_bounds_to_parents()
 
   std::visit(
       [&](auto &nodes) {
-        Set<int> nodes_to_update;
-        nodes_to_update.reserve(node_mask.size());
+        /* Children are always stored after their parent, so processing the nodes from the back
+         * merges the bounds of every parent only once, after all of its children are updated. */
+        BitVector<> nodes_to_update(nodes.size(), false);
+        int last_node = -1;
 
         node_mask.foreach_index([&](int i) {
           if (std::optional<int> parent = nodes[i].parent()) {
-            nodes_to_update.add(*parent);
+            BLI_assert(*parent < i);
+            nodes_to_update[*parent].set();
+            last_node = std::max(last_node, *parent);
           }
         });
 
-        while (!nodes_to_update.is_empty()) {
-          const int node_index = *nodes_to_update.begin();
-          nodes_to_update.remove(node_index);
+        for (int node_index = last_node; node_index >= 0; node_index--) {
+          if (!nodes_to_update[node_index]) {
+            continue;
+          }
 
           auto &node = nodes[node_index];
           const Bounds<float3> old_bounds = node.bounds_;
@@ -1143,7 +1148,7 @@ void Tree::flush_bounds_to_parents()
                                       node.bounds_.max != old_bounds.max;
 
           if (bounds_changed && parent) {
-            nodes_to_update.add(*parent);
+            nodes_to_update[*parent].set();
           }
         }
       },
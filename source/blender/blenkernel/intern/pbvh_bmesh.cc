@@ -2256,6 +2256,11 @@ bool bmesh_update_topology(BMesh &bm,
   const int cd_vert_mask_offset = CustomData_get_offset_named(
       &bm.vdata, CD_PROP_FLOAT, ".sculpt_mask");
 
+  /* NOTE: Topology is edited on a single thread. Adding and removing elements goes through the
+   * #BMesh mempools, the #BMLog and the node id attributes of neighboring elements, none of which
+   * can be modified concurrently. Partitioning the work by leaf node would still need locking at
+   * node boundaries, and the edges are processed in order of length from the shared queues, which
+   * keeps the result independent of the node layout. */
   bool modified = false;
 
   BLI_assert_msg(!view_normal || math::length_squared(*view_normal) > 0.0f,
@@ -22,6 +22,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_mutex.hh"
+#include "BLI_vector.hh"
 
 #ifdef WITH_BULLET
 #  include "RBI_api.h"
@@ -1607,35 +1608,24 @@ static void rigidbody_update_ob_array(RigidBodyWorld *rbw)
     return;
   }
 
-  int n = 0;
+  /* Gather the objects in a single pass over the collection, this runs for every step. */
+  blender::Vector<Object *, 64> objects;
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, object) {
-    (void)object;
     /* Ignore if this object is the direct child of an object with a compound shape */
     if (object->parent == nullptr || object->parent->rigidbody_object == nullptr ||
         object->parent->rigidbody_object->shape != RB_SHAPE_COMPOUND)
     {
-      n++;
+      objects.append(object);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
-  if (rbw->numbodies != n) {
-    rbw->numbodies = n;
+  if (rbw->numbodies != objects.size()) {
+    rbw->numbodies = objects.size();
     rbw->objects = static_cast<Object **>(
         realloc(rbw->objects, sizeof(Object *) * rbw->numbodies));
   }
-
-  int i = 0;
-  FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, object) {
-    /* Ignore if this object is the direct child of an object with a compound shape */
-    if (object->parent == nullptr || object->parent->rigidbody_object == nullptr ||
-        object->parent->rigidbody_object->shape != RB_SHAPE_COMPOUND)
-    {
-      rbw->objects[i] = object;
-      i++;
-    }
-  }
-  FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+  std::copy(objects.begin(), objects.end(), rbw->objects);
 }
 
 static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
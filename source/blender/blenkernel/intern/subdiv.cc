@@ -93,7 +93,13 @@ bool settings_equal(const Settings *settings_a, const Settings *settings_b)
  * Construction.
  */
 
-/* Creation from scratch. */
+/* Creation from scratch.
+ *
+ * NOTE: Every #Subdiv owns its topology refiner, even when many meshes share the same topology.
+ * Sharing refiners between them is not trivial: creating an evaluator refines the topology
+ * refiner in place (see #openSubdiv_createEvaluatorFromTopologyRefiner), so evaluators for
+ * different objects can't be created from the same refiner in parallel. A shared cache would have
+ * to store the refined refiner together with the stencil and patch tables built from it. */
 
 Subdiv *new_from_converter(const Settings *settings, OpenSubdiv_Converter *converter)
 {
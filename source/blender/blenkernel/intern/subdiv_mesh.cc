@@ -1156,7 +1156,13 @@ Mesh *subdiv_to_mesh(Subdiv *subdiv, const ToMeshSettings *settings, const Mesh
 
   stats_begin(&subdiv->stats, SUBDIV_STATS_SUBDIV_TO_MESH);
   /* Make sure evaluator is up to date with possible new topology, and that
-   * it is refined for the new positions of coarse vertices. */
+   * it is refined for the new positions of coarse vertices.
+   *
+   * NOTE: The CPU evaluator is used even when a GPU evaluator would be available. The GPU
+   * evaluator needs an active GPU context, which is not available to depsgraph evaluation for
+   * final renders and exports, and it only fills GPU buffers. Reading those back would also
+   * require a way to evaluate the patches for the vertices of the #ForeachContext traversal
+   * below, which is done one point at a time. */
   if (!eval_begin_from_mesh(subdiv, coarse_mesh, {}, SUBDIV_EVALUATOR_TYPE_CPU, nullptr)) {
     /* This could happen in two situations:
      * - OpenSubdiv is disabled.
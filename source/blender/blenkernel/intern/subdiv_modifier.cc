@@ -24,6 +24,11 @@ using namespace blender::bke;
 subdiv::Settings BKE_subsurf_modifier_settings_init(const SubsurfModifierData *smd,
                                                     const bool use_render_params)
 {
+  /* NOTE: Levels are fixed and don't depend on the view. Choosing them from the projected size of
+   * the object would make every subdivided object depend on the active camera in the depsgraph,
+   * and re-evaluate whenever it moves. View dependent dicing for final renders is handled by the
+   * render engine instead (see the adaptive subdivision option of Cycles, which takes over when
+   * this modifier is last in the stack). */
   const int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
 
   subdiv::Settings settings{};
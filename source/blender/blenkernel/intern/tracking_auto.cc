@@ -15,9 +15,13 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_math_vector_types.hh"
+#include "BLI_path_utils.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_movieclip.h"
 #include "BKE_tracking.h"
@@ -703,6 +707,56 @@ static void autotrack_context_reduce(const void *__restrict /*userdata*/,
   BLI_movelisttolist(&autotrack_tls_join->results, &autotrack_tls->results);
 }
 
+/**
+ * Load the frames the next step will track to into the movie cache, so that reading them
+ * overlaps with tracking the current step instead of stalling all markers of the next one.
+ *
+ * The frames are read and decoded without holding #LOCK_MOVIECLIP, which the markers tracked
+ * meanwhile need to access the frames of the current step. This is only possible for image
+ * sequences, movie files are decoded by a single shared decoder which requires the lock.
+ */
+static void autotrack_context_prefetch_next_frames(const AutoTrackContext *context)
+{
+  const int frame_delta = context->is_backwards ? -1 : 1;
+
+  blender::Vector<blender::int2, MAX_ACCESSOR_CLIP> clip_frames;
+  for (int i = 0; i < context->num_autotrack_markers; ++i) {
+    const libmv_Marker &libmv_marker = context->autotrack_markers[i].libmv_marker;
+    const blender::int2 clip_frame(libmv_marker.clip, libmv_marker.frame + 2 * frame_delta);
+    if (!clip_frames.contains(clip_frame)) {
+      clip_frames.append(clip_frame);
+    }
+  }
+
+  for (const blender::int2 &clip_frame : clip_frames) {
+    MovieClip *clip = context->autotrack_clips[clip_frame[0]].clip;
+    if (clip->source != MCLIP_SRC_SEQUENCE) {
+      continue;
+    }
+    const int scene_frame = BKE_movieclip_remap_clip_to_scene_frame(clip, clip_frame[1]);
+
+    MovieClipUser user = {};
+    BKE_movieclip_user_set_frame(&user, scene_frame);
+    user.render_size = MCLIP_PROXY_RENDER_SIZE_FULL;
+    user.render_flag = 0;
+
+    if (BKE_movieclip_has_cached_frame(clip, &user)) {
+      continue;
+    }
+
+    char filepath[FILE_MAX];
+    BKE_movieclip_filepath_for_frame(clip, &user, filepath);
+    const int flag = IB_byte_data | IB_multilayer | IB_alphamode_detect | IB_metadata;
+    ImBuf *ibuf = IMB_load_image_from_filepath(filepath, flag, clip->colorspace_settings.name);
+    if (ibuf == nullptr) {
+      continue;
+    }
+    BKE_movieclip_convert_multilayer_ibuf(ibuf);
+    BKE_movieclip_put_frame_if_possible(clip, &user, ibuf);
+    IMB_freeImBuf(ibuf);
+  }
+}
+
 bool BKE_autotrack_context_step(AutoTrackContext *context)
 {
   if (context->num_autotrack_markers == 0) {
@@ -719,8 +773,12 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
   settings.userdata_chunk_size = sizeof(AutoTrackTLS);
   settings.func_reduce = autotrack_context_reduce;
 
-  BLI_task_parallel_range(
-      0, context->num_autotrack_markers, context, autotrack_context_step_cb, &settings);
+  blender::threading::parallel_invoke(
+      [&]() {
+        BLI_task_parallel_range(
+            0, context->num_autotrack_markers, context, autotrack_context_step_cb, &settings);
+      },
+      [&]() { autotrack_context_prefetch_next_frames(context); });
 
   /* Prepare next tracking step by updating the AutoTrack context with new markers and moving
    * tracked markers as an input for the next iteration. */
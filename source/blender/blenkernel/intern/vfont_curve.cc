@@ -19,6 +19,7 @@
 
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_math_base_safe.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
@@ -26,6 +27,7 @@
 #include "BLI_string_utf8.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector_set.hh"
 
 #include "DNA_curve_types.h"
 #include "DNA_object_types.h"
@@ -148,6 +150,50 @@ static VChar *vfont_char_ensure_with_lock(VFont *vfont, char32_t charcode)
   return che;
 }
 
+/**
+ * Load all characters of the text that aren't cached yet before the layout needs them, so each
+ * font is only loaded once instead of once for every missing character.
+ */
+static void vfont_chars_ensure_with_lock(const Curve *cu,
+                                         const char32_t *mem,
+                                         const CharInfo *custrinfo,
+                                         const int slen)
+{
+  blender::Map<VFont *, blender::VectorSet<uint>> chars_by_vfont;
+  for (int i = 0; i < slen; i++) {
+    const CharInfo *info = &custrinfo[i];
+    char32_t charcode = mem[i];
+    if (info->flag & CU_CHINFO_SMALLCAPS) {
+      charcode = towupper(charcode);
+    }
+    if (ELEM(charcode, '\n', '\0')) {
+      continue;
+    }
+    if (VFont *vfont = vfont_from_charinfo(cu, info)) {
+      chars_by_vfont.lookup_or_add_default(vfont).add(uint(charcode));
+    }
+  }
+
+  for (auto &&[vfont, chars] : chars_by_vfont.items()) {
+    const VFontData *vfd = vfont_data_ensure_with_lock(vfont);
+    if (vfd == nullptr) {
+      continue;
+    }
+    BLI_rw_mutex_lock(&vfont_rwlock, THREAD_LOCK_READ);
+    const bool has_missing = std::any_of(chars.begin(), chars.end(), [&](const uint charcode) {
+      return vfont_char_find(vfd, charcode) == nullptr;
+    });
+    BLI_rw_mutex_unlock(&vfont_rwlock);
+
+    if (has_missing) {
+      /* Characters that were loaded by another thread in the meantime are skipped. */
+      BLI_rw_mutex_lock(&vfont_rwlock, THREAD_LOCK_WRITE);
+      BKE_vfontdata_chars_from_freetypefont(vfont, chars);
+      BLI_rw_mutex_unlock(&vfont_rwlock);
+    }
+  }
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -819,6 +865,8 @@ static bool vfont_to_curve(Object *ob,
     curbox = 0;
   }
 
+  vfont_chars_ensure_with_lock(cu, mem, custrinfo, slen);
+
   i = 0;
   while (i <= slen) {
     /* Characters in the list. */
@@ -86,12 +86,12 @@ VFontData *BKE_vfontdata_copy(const VFontData *vfont_src, const int /*flag*/)
   return vfont_dst;
 }
 
-VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, uint character)
+/**
+ * Load the font of \a vfont into BLF, the caller is responsible for unloading it.
+ * \return The font ID or -1 when the font can't be loaded.
+ */
+static int vfontdata_font_load(VFont *vfont, bool *r_use_fallback)
 {
-  if (!vfont) {
-    return nullptr;
-  }
-
   int font_id = -1;
   const bool is_builtin = BKE_vfont_is_builtin(vfont);
 
@@ -102,7 +102,7 @@ VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, uint character)
    * only allow characters that are included in that font.
    * Do this for predictable control of what is shown when selecting specific fonts,
    * also for consistent output when the UI fonts are changed or updated. */
-  const bool use_fallback = is_builtin;
+  *r_use_fallback = is_builtin;
 
   if (is_builtin) {
     font_id = BLF_load_mem(
@@ -113,23 +113,68 @@ VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, uint character)
         vfont->data->name, static_cast<const uchar *>(vfont->temp_pf->data), vfont->temp_pf->size);
   }
 
-  if (font_id == -1) {
-    return nullptr;
+  if (font_id != -1) {
+    /* need to set a size for embolden, etc. */
+    BLF_size(font_id, 16);
   }
+  return font_id;
+}
 
+static VChar *vfontdata_char_add(VFont *vfont,
+                                 const int font_id,
+                                 const bool use_fallback,
+                                 const uint character)
+{
   VChar *che = MEM_callocN<VChar>("objfnt_char");
-
-  /* need to set a size for embolden, etc. */
-  BLF_size(font_id, 16);
-
   che->width = BLF_character_to_curves(
       font_id, character, &che->nurbsbase, vfont->data->metrics.scale, use_fallback);
-
   BLI_ghash_insert(vfont->data->characters, POINTER_FROM_UINT(character), che);
+  return che;
+}
+
+VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, uint character)
+{
+  if (!vfont) {
+    return nullptr;
+  }
+
+  bool use_fallback;
+  const int font_id = vfontdata_font_load(vfont, &use_fallback);
+  if (font_id == -1) {
+    return nullptr;
+  }
+
+  VChar *che = vfontdata_char_add(vfont, font_id, use_fallback, character);
   BLF_unload_id(font_id);
   return che;
 }
 
+void BKE_vfontdata_chars_from_freetypefont(VFont *vfont, const blender::Span<uint> characters)
+{
+  if (!vfont || characters.is_empty()) {
+    return;
+  }
+
+  int font_id = -1;
+  bool use_fallback = false;
+  for (const uint character : characters) {
+    if (BLI_ghash_haskey(vfont->data->characters, POINTER_FROM_UINT(character))) {
+      continue;
+    }
+    if (font_id == -1) {
+      font_id = vfontdata_font_load(vfont, &use_fallback);
+      if (font_id == -1) {
+        return;
+      }
+    }
+    vfontdata_char_add(vfont, font_id, use_fallback, character);
+  }
+
+  if (font_id != -1) {
+    BLF_unload_id(font_id);
+  }
+}
+
 VChar *BKE_vfontdata_char_copy(const VChar *vchar_src)
 {
   VChar *vchar_dst = static_cast<VChar *>(MEM_dupallocN(vchar_src));
@@ -541,6 +541,9 @@ void BKE_volume_unload(Volume *volume)
     const char *volume_name = volume->id.name + 2;
     CLOG_INFO(&LOG, 1, "Volume %s: unload", volume_name);
     grids.clear_all();
+    /* Grids of the previous file (e.g. the previous frame of a sequence) keep their loaded trees
+     * alive as long as they are referenced by the file cache, so release them now. */
+    blender::bke::volume_grid::file_cache::unload_unused();
   }
 #else
   UNUSED_VARS(volume);
@@ -309,6 +309,17 @@ void unload_unused()
           [&](const auto &item) { return item.value->is_mutable(); });
     }
   }
+  /* Also forget about files that don't have any grid in use anymore. Otherwise the meta-data of
+   * every file of an animated sequence is kept around. The loaded trees themselves are owned by
+   * the global #memory_cache, which has its own size limit. */
+  global_cache.file_map.remove_if([](const auto &item) {
+    for (const GridCache &grid_cache : item.value.grids) {
+      if (!grid_cache.grid_by_simplify_level.is_empty()) {
+        return false;
+      }
+    }
+    return true;
+  });
 }
 
 }  // namespace blender::bke::volume_grid::file_cache
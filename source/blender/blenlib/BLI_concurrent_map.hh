@@ -23,16 +23,131 @@
 #      undef NOMINMAX
 #    endif
 #  endif
-#else
-#  include "BLI_mutex.hh"
-#  include "BLI_set.hh"
 #endif
 
+#include <array>
+
 #include "BLI_hash.hh"
 #include "BLI_hash_tables.hh"
+#include "BLI_mutex.hh"
+#include "BLI_set.hh"
 
 namespace blender {
 
+namespace concurrent_map_detail {
+
+/**
+ * The implementation of #ConcurrentMap that is used when TBB is not available. It is compiled in
+ * either case, so that it can be tested in builds with TBB too.
+ *
+ * It splits the keys into a fixed number of shards with their own lock, so that threads only
+ * contend when they access keys of the same shard.
+ */
+template<typename Key,
+         typename Value,
+         typename Hash = DefaultHash<Key>,
+         typename IsEqual = DefaultEquality<Key>>
+class ShardedMap {
+ private:
+  /**
+   * We actually use a #Set, because the API expects the key and value to be stored in a
+   * `std::pair`. #Set can support this use case too.
+   */
+  struct SetKey {
+    std::pair<Key, Value> item;
+
+    SetKey(Key key) : item(std::move(key), Value()) {}
+
+    uint64_t hash() const
+    {
+      return Hash{}(this->item.first);
+    }
+
+    static uint64_t hash_as(const Key &key)
+    {
+      return Hash{}(key);
+    }
+
+    friend bool operator==(const SetKey &a, const SetKey &b)
+    {
+      return IsEqual{}(a.item.first, b.item.first);
+    }
+
+    friend bool operator==(const Key &a, const SetKey &b)
+    {
+      return IsEqual{}(a, b.item.first);
+    }
+
+    friend bool operator==(const SetKey &a, const Key &b)
+    {
+      return IsEqual{}(a.item.first, b);
+    }
+  };
+
+  using UsedSet = Set<SetKey>;
+
+  struct Shard {
+    Mutex mutex;
+    UsedSet set;
+  };
+
+  /* Must match the shift in #get_shard. */
+  static constexpr int shards_num = 64;
+  std::array<Shard, shards_num> shards_;
+
+  Shard &get_shard(const Key &key)
+  {
+    /* Mix the hash, because hashes of small integer keys only use the low bits. */
+    const uint64_t hash = uint64_t(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+    return shards_[hash >> 58];
+  }
+
+ public:
+  struct Accessor {
+    std::unique_lock<Mutex> mutex;
+    std::pair<Key, Value> *data = nullptr;
+
+    std::pair<Key, Value> *operator->()
+    {
+      return this->data;
+    }
+  };
+
+  using MutableAccessor = Accessor;
+  using ConstAccessor = Accessor;
+
+  bool lookup(Accessor &accessor, const Key &key)
+  {
+    Shard &shard = this->get_shard(key);
+    accessor.mutex = std::unique_lock(shard.mutex);
+    SetKey *stored_key = const_cast<SetKey *>(shard.set.lookup_key_ptr_as(key));
+    if (!stored_key) {
+      return false;
+    }
+    accessor.data = &stored_key->item;
+    return true;
+  }
+
+  bool add(Accessor &accessor, const Key &key)
+  {
+    Shard &shard = this->get_shard(key);
+    accessor.mutex = std::unique_lock(shard.mutex);
+    const bool newly_added = !shard.set.contains_as(key);
+    SetKey &stored_key = const_cast<SetKey &>(shard.set.lookup_key_or_add_as(key));
+    accessor.data = &stored_key.item;
+    return newly_added;
+  }
+
+  bool remove(const Key &key)
+  {
+    Shard &shard = this->get_shard(key);
+    std::unique_lock lock(shard.mutex);
+    return shard.set.remove_as(key);
+  }
+};
+
+}  // namespace concurrent_map_detail
+
 /**
  * A #ConcurrentMap allows adding, removing and looking up values from multiple threads
  * concurrently. It has higher memory and performance overhead than a simple #Map when not used
@@ -47,6 +162,7 @@ namespace blender {
  * This is a thin wrapper around #tbb::concurrent_hash_map that also has a fallback implementation
  * if TBB is not available. The fallback implementation is not optimized for performance. It mainly
  * intends to be a simple implementation that can compile whenever the TBB variant can compile.
+ * See #concurrent_map_detail::ShardedMap.
  */
 template<typename Key,
          typename Value,
@@ -126,84 +242,26 @@ class ConcurrentMap {
 
 #else
  private:
-  /**
-   * In the fallback implementation, we actually use a #Set, because the API expects the key and
-   * value to be stored in a `std::pair`. #Set can support this use case too.
-   */
-  struct SetKey {
-    std::pair<Key, Value> item;
-
-    SetKey(Key key) : item(std::move(key), Value()) {}
-
-    uint64_t hash() const
-    {
-      return Hash{}(this->item.first);
-    }
-
-    static uint64_t hash_as(const Key &key)
-    {
-      return Hash{}(key);
-    }
-
-    friend bool operator==(const SetKey &a, const SetKey &b)
-    {
-      return IsEqual{}(a.item.first, b.item.first);
-    }
-
-    friend bool operator==(const Key &a, const SetKey &b)
-    {
-      return IsEqual{}(a, b.item.first);
-    }
-
-    friend bool operator==(const SetKey &a, const Key &b)
-    {
-      return IsEqual{}(a.item.first, b);
-    }
-  };
-
-  using UsedSet = Set<SetKey>;
-
-  struct Accessor {
-    std::unique_lock<Mutex> mutex;
-    std::pair<Key, Value> *data = nullptr;
-
-    std::pair<Key, Value> *operator->()
-    {
-      return this->data;
-    }
-  };
-
-  Mutex mutex_;
-  UsedSet set_;
+  using FallbackMap = concurrent_map_detail::ShardedMap<Key, Value, Hash, IsEqual>;
+  FallbackMap map_;
 
  public:
-  using MutableAccessor = Accessor;
-  using ConstAccessor = Accessor;
+  using MutableAccessor = typename FallbackMap::MutableAccessor;
+  using ConstAccessor = typename FallbackMap::ConstAccessor;
 
-  bool lookup(Accessor &accessor, const Key &key)
+  bool lookup(MutableAccessor &accessor, const Key &key)
   {
-    accessor.mutex = std::unique_lock(mutex_);
-    SetKey *stored_key = const_cast<SetKey *>(set_.lookup_key_ptr_as(key));
-    if (!stored_key) {
-      return false;
-    }
-    accessor.data = &stored_key->item;
-    return true;
+    return map_.lookup(accessor, key);
   }
 
-  bool add(Accessor &accessor, const Key &key)
+  bool add(MutableAccessor &accessor, const Key &key)
   {
-    accessor.mutex = std::unique_lock(mutex_);
-    const bool newly_added = !set_.contains_as(key);
-    SetKey &stored_key = const_cast<SetKey &>(set_.lookup_key_or_add_as(key));
-    accessor.data = &stored_key.item;
-    return newly_added;
+    return map_.add(accessor, key);
   }
 
   bool remove(const Key &key)
   {
-    std::unique_lock lock(mutex_);
-    return set_.remove_as(key);
+    return map_.remove(key);
   }
 
 #endif
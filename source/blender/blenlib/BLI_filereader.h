@@ -53,6 +53,20 @@ FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
+/**
+ * Direct access to the memory backing a #FileReader created with #BLI_filereader_new_memory or
+ * #BLI_filereader_new_mmap, this allows using data in-place instead of reading a copy of it.
+ *
+ * \return The start of the memory, or NULL for other kinds of readers.
+ *
+ * \note For memory-mapped files, IO errors only become known after accessing the memory, so
+ * #BLI_filereader_memory_any_io_error must be checked once access is done.
+ */
+const void *BLI_filereader_memory_data(const FileReader *reader, size_t *r_length)
+    ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1, 2);
+/** Whether accessing the memory returned by #BLI_filereader_memory_data failed. */
+bool BLI_filereader_memory_any_io_error(const FileReader *reader) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL(1);
 /** Create #FileReader from applying `Zstd` decompression on an underlying file. */
 FileReader *BLI_filereader_new_zstd(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 /** Create #FileReader from applying `Gzip` decompression on an underlying file. */
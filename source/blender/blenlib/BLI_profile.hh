@@ -0,0 +1,71 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ *
+ * Lightweight profiling of named scopes ("zones") across threads. The zones are always compiled
+ * in, but only recorded while profiling is enabled, so the cost of an inactive zone is a single
+ * atomic load. The recorded zones are written in the Chrome trace event format, which can be
+ * opened in Perfetto (https://ui.perfetto.dev) or `chrome://tracing`.
+ *
+ * Use #BLI_PROFILE_SCOPE for scopes that may be hit often, unlike #SCOPED_TIMER it doesn't print
+ * anything while the program runs.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "BLI_string_ref.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::profile {
+
+namespace detail {
+extern std::atomic<bool> is_enabled;
+void record_zone(const char *name, timeit::TimePoint start, timeit::TimePoint end);
+}  // namespace detail
+
+inline bool is_enabled()
+{
+  return detail::is_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Start recording zones. Zones that were recorded before are discarded.
+ * \param filepath: The file the trace is written to when profiling is stopped.
+ */
+void start(StringRefNull filepath);
+/** Stop recording zones and write all recorded zones to the file passed to #start. */
+void stop();
+
+class ScopedZone {
+ private:
+  const char *name_;
+  timeit::TimePoint start_;
+
+ public:
+  /** \param name: Has to be a string that lives until profiling is stopped, usually a literal. */
+  ScopedZone(const char *name) : name_(is_enabled() ? name : nullptr)
+  {
+    if (name_) {
+      start_ = timeit::Clock::now();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (name_) {
+      detail::record_zone(name_, start_, timeit::Clock::now());
+    }
+  }
+
+  ScopedZone(const ScopedZone &) = delete;
+  ScopedZone &operator=(const ScopedZone &) = delete;
+};
+
+}  // namespace blender::profile
+
+#define BLI_PROFILE_SCOPE(name) blender::profile::ScopedZone profile_zone(name)
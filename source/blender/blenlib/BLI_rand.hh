@@ -131,21 +131,36 @@ class RandomNumberGenerator {
 
   /**
    * Simulate getting \a n random values.
+   * This jumps ahead in logarithmic time, so it can be used to split up a sequence of random
+   * values between many threads.
    */
   void skip(int64_t n)
   {
-    while (n--) {
-      this->step();
+    /* Combine the linear congruential steps by repeated squaring. The arithmetic wraps around at
+     * 2^64, which is fine because the state only uses the lower 48 bits. */
+    uint64_t step_multiplier = multiplier;
+    uint64_t step_addend = addend;
+    uint64_t total_multiplier = 1;
+    uint64_t total_addend = 0;
+    while (n > 0) {
+      if (n & 1) {
+        total_multiplier *= step_multiplier;
+        total_addend = total_addend * step_multiplier + step_addend;
+      }
+      step_addend *= step_multiplier + 1;
+      step_multiplier *= step_multiplier;
+      n >>= 1;
     }
+    x_ = (total_multiplier * x_ + total_addend) & mask;
   }
 
  private:
+  static constexpr uint64_t multiplier = 0x5DEECE66Dll;
+  static constexpr uint64_t addend = 0xB;
+  static constexpr uint64_t mask = 0x0000FFFFFFFFFFFFll;
+
   void step()
   {
-    constexpr uint64_t multiplier = 0x5DEECE66Dll;
-    constexpr uint64_t addend = 0xB;
-    constexpr uint64_t mask = 0x0000FFFFFFFFFFFFll;
-
     x_ = (multiplier * x_ + addend) & mask;
   }
 };
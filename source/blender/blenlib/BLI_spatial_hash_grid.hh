@@ -0,0 +1,122 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * A uniform grid over a set of points, for fixed radius neighbor queries. The cells are found
+ * through a hash of their integer coordinates, so the bounds of the points don't have to be known
+ * and empty space costs nothing. Building the grid is a parallel counting sort of the points by
+ * their hash bucket, which is cheap enough to do whenever the points move.
+ *
+ * Compared to #KDTree_3d and #BVHTree this only supports radius queries, and works best when the
+ * query radius is close to the cell size.
+ */
+
+#include "BLI_array.hh"
+#include "BLI_hash.hh"
+#include "BLI_index_mask_fwd.hh"
+#include "BLI_math_vector.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_set.hh"
+
+namespace blender {
+
+class SpatialHashGrid {
+ private:
+  float cell_size_inv_ = 0.0f;
+  /** The number of buckets minus one, the number of buckets is a power of two. */
+  uint64_t bucket_mask_ = 0;
+  /** Offsets of every bucket into #indices_ and #positions_. */
+  Array<int> bucket_offsets_;
+  /** The original indices of the points, grouped by bucket and sorted within a bucket. */
+  Array<int> indices_;
+  /** The positions in the same order as #indices_, so a query reads them sequentially. */
+  Array<float3> positions_;
+
+ public:
+  SpatialHashGrid() = default;
+  /**
+   * \param cell_size: Should be about the radius of the queries. Larger radii still work, but
+   * have to visit more cells.
+   */
+  SpatialHashGrid(Span<float3> positions, float cell_size);
+  /** Only add the points in \a mask, queries still report indices into \a positions. */
+  SpatialHashGrid(Span<float3> positions, const IndexMask &mask, float cell_size);
+
+  bool is_empty() const
+  {
+    return indices_.is_empty();
+  }
+
+  /**
+   * Call \a fn with the index and the squared distance of every point that is closer than
+   * \a radius to \a co. The order of the calls only depends on the positions, not on the
+   * threading used to build the grid.
+   */
+  template<typename Fn>
+  void foreach_in_radius(const float3 &co, const float radius, const Fn &fn) const
+  {
+    if (this->is_empty()) {
+      return;
+    }
+    const float radius_sq = radius * radius;
+    const OffsetIndices<int> buckets = bucket_offsets_.as_span();
+    const auto foreach_in_bucket = [&](const int64_t bucket) {
+      for (const int i : buckets[bucket]) {
+        const float dist_sq = math::distance_squared(co, positions_[i]);
+        if (dist_sq < radius_sq) {
+          fn(indices_[i], dist_sq);
+        }
+      }
+    };
+
+    const int3 min_cell = this->cell_of(co - float3(radius));
+    const int3 max_cell = this->cell_of(co + float3(radius));
+    const int3 cells_num = max_cell - min_cell + int3(1);
+    if (double(cells_num.x) * double(cells_num.y) * double(cells_num.z) >
+        double(buckets.size()))
+    {
+      /* Every bucket would be visited anyway. */
+      for (const int64_t bucket : buckets.index_range()) {
+        foreach_in_bucket(bucket);
+      }
+      return;
+    }
+
+    /* Different cells can share a bucket, make sure no point is reported twice. */
+    Set<int64_t, 32> visited_buckets;
+    for (int z = min_cell.z; z <= max_cell.z; z++) {
+      for (int y = min_cell.y; y <= max_cell.y; y++) {
+        for (int x = min_cell.x; x <= max_cell.x; x++) {
+          const int64_t bucket = this->bucket_of(int3(x, y, z));
+          if (!visited_buckets.add(bucket)) {
+            continue;
+          }
+          foreach_in_bucket(bucket);
+        }
+      }
+    }
+  }
+
+ private:
+  /**
+   * Coordinates far away from the origin are clamped into the outermost cells, so that the cell
+   * coordinates and the number of cells between them fit into an integer.
+   */
+  int3 cell_of(const float3 &co) const
+  {
+    constexpr float limit = float(1 << 29);
+    return int3(math::clamp(math::floor(co * cell_size_inv_), float3(-limit), float3(limit)));
+  }
+
+  int64_t bucket_of(const int3 &cell) const
+  {
+    return int64_t(get_default_hash(cell.x, cell.y, cell.z) & bucket_mask_);
+  }
+};
+
+}  // namespace blender
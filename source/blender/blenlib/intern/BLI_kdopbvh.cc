@@ -34,7 +34,9 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
 
@@ -1018,13 +1020,29 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
 {
   /* Update bottom=>top
    * TRICKY: the way we build the tree all the children have an index greater than the parent
-   * This allows us todo a bottom up update by starting on the bigger numbered branch. */
+   * This allows us todo a bottom up update by starting on the bigger numbered branch.
+   *
+   * The branches are stored level by level (see #non_recursive_bvh_div_nodes), and branches only
+   * depend on their children in the levels below. So the levels are updated from the bottom, and
+   * the branches of each level in parallel. */
+  const int tree_type = tree->tree_type;
+  const int tree_offset = 2 - tree->tree_type;
 
-  BVHNode **root = tree->nodes + tree->leaf_num;
-  BVHNode **index = tree->nodes + tree->leaf_num + tree->branch_num - 1;
+  /* Ranges of the branches on each level, with the one based indexing of the build. */
+  blender::Vector<blender::IndexRange> levels;
+  for (int i = 1; i <= tree->branch_num; i = i * tree_type + tree_offset) {
+    const int i_stop = min_ii(i * tree_type + tree_offset, tree->branch_num + 1);
+    levels.append(blender::IndexRange::from_begin_end(i, i_stop));
+  }
 
-  for (; index >= root; index--) {
-    node_join(tree, *index);
+  BVHNode **branches = tree->nodes + tree->leaf_num - 1;
+  for (int64_t level_i = levels.size() - 1; level_i >= 0; level_i--) {
+    blender::threading::parallel_for(
+        levels[level_i], 1024, [&](const blender::IndexRange range) {
+          for (const int64_t i : range) {
+            node_join(tree, branches[i]);
+          }
+        });
   }
 }
 int BLI_bvhtree_get_len(const BVHTree *tree)
@@ -14,14 +14,15 @@
  *  - Literals:
  *      floating point and decimal integer.
  *  - Constants:
- *      pi, True, False
+ *      pi, e, tau, True, False
  *  - Operators:
- *      +, -, *, /, ==, !=, <, <=, >, >=, and, or, not, ternary if
+ *      +, -, *, /, //, %, **, ==, !=, <, <=, >, >=, and, or, not, ternary if
  *  - Functions:
  *      min, max, radians, degrees,
  *      abs, fabs, floor, ceil, trunc, int,
  *      sin, cos, tan, asin, acos, atan, atan2,
- *      exp, log, sqrt, pow, fmod
+ *      sinh, cosh, tanh, hypot, copysign,
+ *      exp, log, log2, log10, sqrt, pow, fmod
  *
  * The implementation has no global state and can be used multi-threaded.
  */
@@ -288,6 +289,47 @@ static double op_div(double a, double b)
   return a / b;
 }
 
+/* Floor division with the semantics of Python floats. */
+static double op_floordiv(double a, double b)
+{
+  if (b == 0.0) {
+    /* Raise the same floating point exceptions as a regular division. */
+    return a / b;
+  }
+
+  double mod = fmod(a, b);
+  double div = (a - mod) / b;
+  if (mod != 0.0 && (b < 0.0) != (mod < 0.0)) {
+    div -= 1.0;
+  }
+  if (div == 0.0) {
+    return copysign(0.0, a / b);
+  }
+  double floordiv = floor(div);
+  if (div - floordiv > 0.5) {
+    floordiv += 1.0;
+  }
+  return floordiv;
+}
+
+/* Modulo with the semantics of Python floats: the result has the sign of the divisor. */
+static double op_mod(double a, double b)
+{
+  if (b == 0.0) {
+    /* Raise the same floating point exceptions as a regular division. */
+    return a / b;
+  }
+
+  double mod = fmod(a, b);
+  if (mod == 0.0) {
+    return copysign(0.0, b);
+  }
+  if ((b < 0.0) != (mod < 0.0)) {
+    mod += b;
+  }
+  return mod;
+}
+
 static double op_add(double a, double b)
 {
   return a + b;
@@ -342,6 +384,16 @@ static double op_not(double a)
   return a ? 0.0 : 1.0;
 }
 
+static double op_bool(double a)
+{
+  return a ? 1.0 : 0.0;
+}
+
+static double op_float(double a)
+{
+  return a;
+}
+
 static double op_eq(double a, double b)
 {
   return a == b ? 1.0 : 0.0;
@@ -377,8 +429,12 @@ struct BuiltinConstDef {
   double value;
 };
 
-static BuiltinConstDef builtin_consts[] = {
-    {"pi", M_PI}, {"True", 1.0}, {"False", 0.0}, {nullptr, 0.0}};
+static BuiltinConstDef builtin_consts[] = {{"pi", M_PI},
+                                           {"e", M_E},
+                                           {"tau", 2.0 * M_PI},
+                                           {"True", 1.0},
+                                           {"False", 0.0},
+                                           {nullptr, 0.0}};
 
 struct BuiltinOpDef {
   const char *name;
@@ -419,6 +475,8 @@ static BuiltinOpDef builtin_ops[] = {
     {"trunc", UnaryOpFunc(trunc)},
     {"round", UnaryOpFunc(round)},
     {"int", UnaryOpFunc(trunc)},
+    {"float", UnaryOpFunc(op_float)},
+    {"bool", UnaryOpFunc(op_bool)},
     {"sin", UnaryOpFunc(sin)},
     {"cos", UnaryOpFunc(cos)},
     {"tan", UnaryOpFunc(tan)},
@@ -426,9 +484,21 @@ static BuiltinOpDef builtin_ops[] = {
     {"acos", UnaryOpFunc(acos)},
     {"atan", UnaryOpFunc(atan)},
     {"atan2", BinaryOpFunc(atan2)},
+    {"sinh", UnaryOpFunc(sinh)},
+    {"cosh", UnaryOpFunc(cosh)},
+    {"tanh", UnaryOpFunc(tanh)},
+    {"asinh", UnaryOpFunc(asinh)},
+    {"acosh", UnaryOpFunc(acosh)},
+    {"atanh", UnaryOpFunc(atanh)},
+    {"hypot", BinaryOpFunc(hypot)},
+    {"copysign", BinaryOpFunc(copysign)},
     {"exp", UnaryOpFunc(exp)},
+    {"expm1", UnaryOpFunc(expm1)},
     {"log", UnaryOpFunc(log)},
     {"log", BinaryOpFunc(op_log2)},
+    {"log2", UnaryOpFunc(log2)},
+    {"log10", UnaryOpFunc(log10)},
+    {"log1p", UnaryOpFunc(log1p)},
     {"sqrt", UnaryOpFunc(sqrt)},
     {"pow", BinaryOpFunc(pow)},
     {"fmod", BinaryOpFunc(fmod)},
@@ -466,6 +536,8 @@ static BuiltinOpDef builtin_ops[] = {
 #define TOKEN_NOT MAKE_CHAR2('N', 'O')
 #define TOKEN_IF MAKE_CHAR2('I', 'F')
 #define TOKEN_ELSE MAKE_CHAR2('E', 'L')
+#define TOKEN_POW MAKE_CHAR2('*', '*')
+#define TOKEN_FLOORDIV MAKE_CHAR2('/', '/')
 
 static const char *token_eq_characters = "!=><";
 static const char *token_characters = "~`!@#$%^&*+-=/\\?:;<>(){}[]|.,\"'";
@@ -677,6 +749,15 @@ static bool parse_next_token(ExprParseState *state)
     return true;
   }
 
+  /* Repeated-character tokens. */
+  if ((state->cur[0] == '*' && state->cur[1] == '*') ||
+      (state->cur[0] == '/' && state->cur[1] == '/'))
+  {
+    state->token = MAKE_CHAR2(state->cur[0], state->cur[1]);
+    state->cur += 2;
+    return true;
+  }
+
   /* Special characters (single character tokens) */
   if (strchr(token_characters, *state->cur)) {
     state->token = *state->cur++;
@@ -749,19 +830,11 @@ static int parse_function_args(ExprParseState *state)
   }
 }
 
-static bool parse_unary(ExprParseState *state)
+static bool parse_primary(ExprParseState *state)
 {
   int i;
 
   switch (state->token) {
-    case '+':
-      return parse_next_token(state) && parse_unary(state);
-
-    case '-':
-      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
-      parse_add_func(state, op_negate);
-      return true;
-
     case '(':
       return parse_next_token(state) && parse_expr(state) && state->token == ')' &&
              parse_next_token(state);
@@ -835,6 +908,37 @@ static bool parse_unary(ExprParseState *state)
   }
 }
 
+static bool parse_unary(ExprParseState *state);
+
+/* The power operator binds tighter than unary operators on its left, and is right-associative. */
+static bool parse_power(ExprParseState *state)
+{
+  CHECK_ERROR(parse_primary(state));
+
+  if (state->token == TOKEN_POW) {
+    CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+    parse_add_func(state, BinaryOpFunc(pow));
+  }
+
+  return true;
+}
+
+static bool parse_unary(ExprParseState *state)
+{
+  switch (state->token) {
+    case '+':
+      return parse_next_token(state) && parse_unary(state);
+
+    case '-':
+      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+      parse_add_func(state, op_negate);
+      return true;
+
+    default:
+      return parse_power(state);
+  }
+}
+
 static bool parse_mul(ExprParseState *state)
 {
   CHECK_ERROR(parse_unary(state));
@@ -851,6 +955,16 @@ static bool parse_mul(ExprParseState *state)
         parse_add_func(state, op_div);
         break;
 
+      case TOKEN_FLOORDIV:
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_floordiv);
+        break;
+
+      case '%':
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_mod);
+        break;
+
       default:
         return true;
     }
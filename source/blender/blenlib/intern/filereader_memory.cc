@@ -129,3 +129,26 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+const void *BLI_filereader_memory_data(const FileReader *reader, size_t *r_length)
+{
+  const MemoryReader *mem = (const MemoryReader *)reader;
+  if (reader->read == memory_read_raw) {
+    *r_length = mem->length;
+    return mem->data;
+  }
+  if (reader->read == memory_read_mmap) {
+    *r_length = mem->length;
+    return BLI_mmap_get_pointer(mem->mmap);
+  }
+  *r_length = 0;
+  return nullptr;
+}
+
+bool BLI_filereader_memory_any_io_error(const FileReader *reader)
+{
+  if (reader->read == memory_read_mmap) {
+    return BLI_mmap_any_io_error(((const MemoryReader *)reader)->mmap);
+  }
+  return false;
+}
@@ -12,9 +12,36 @@
 
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 
 #include "MEM_guardedalloc.h"
 
+/** Maximum number of frames decompressed ahead of the reading position. */
+#define ZSTD_READAHEAD_FRAMES_MAX 8
+
+enum eZstdReadAheadState {
+  /** The slot is not used. */
+  ZSTD_READAHEAD_EMPTY = 0,
+  /** Compressed data has been read, waiting for a thread to decompress it. */
+  ZSTD_READAHEAD_PENDING,
+  /** A thread is decompressing the frame. */
+  ZSTD_READAHEAD_RUNNING,
+  /** The frame is decompressed (or failed to, in which case `uncompressed_data` is null). */
+  ZSTD_READAHEAD_DONE,
+};
+
+/** A frame decompressed ahead of time in a worker thread. */
+struct ZstdReadAheadFrame {
+  int frame;
+  eZstdReadAheadState state;
+
+  char *compressed_data;
+  size_t compressed_size;
+  char *uncompressed_data;
+  size_t uncompressed_size;
+};
+
 struct ZstdReader {
   FileReader reader;
 
@@ -32,6 +59,25 @@ struct ZstdReader {
     char *cached_content;
     int cached_frame;
   } seek;
+
+  /**
+   * When reading a seekable file forward, the next frames are decompressed in parallel so that
+   * they are ready once reading reaches them. Only the decompression is threaded, reading from
+   * the base #FileReader is always done by the thread calling the #FileReader functions.
+   *
+   * Slots are protected by `mutex`, except for the data of a slot in the
+   * #ZSTD_READAHEAD_RUNNING state which belongs to the thread decompressing it.
+   */
+  struct {
+    TaskPool *task_pool;
+    ZstdReadAheadFrame frames[ZSTD_READAHEAD_FRAMES_MAX];
+    int frames_num;
+    /** Highest frame that was requested so far, read-ahead only happens when going past it. */
+    int front_frame;
+
+    ThreadMutex mutex;
+    ThreadCondition condition;
+  } readahead;
 };
 
 static bool zstd_read_u32(FileReader *base, uint32_t *val)
@@ -153,6 +199,227 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
+/* Read the compressed data of a frame from the base file, returns null on failure. */
+static char *zstd_read_compressed_frame(ZstdReader *zstd, int frame, size_t *r_compressed_size)
+{
+  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
+
+  char *compressed_data = MEM_malloc_arrayN<char>(compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
+  {
+    MEM_freeN(compressed_data);
+    return nullptr;
+  }
+
+  *r_compressed_size = compressed_size;
+  return compressed_data;
+}
+
+static void zstd_readahead_decompress(ZstdReadAheadFrame *slot)
+{
+  char *uncompressed_data = MEM_malloc_arrayN<char>(slot->uncompressed_size, __func__);
+  /* Worker threads can't share the context of the reader, use a temporary one. */
+  size_t res = ZSTD_decompress(
+      uncompressed_data, slot->uncompressed_size, slot->compressed_data, slot->compressed_size);
+  if (ZSTD_isError(res) || res < slot->uncompressed_size) {
+    MEM_freeN(uncompressed_data);
+    uncompressed_data = nullptr;
+  }
+  MEM_freeN(slot->compressed_data);
+  slot->compressed_data = nullptr;
+  slot->uncompressed_data = uncompressed_data;
+}
+
+static void zstd_readahead_task_run(TaskPool *__restrict pool, void *taskdata)
+{
+  ZstdReader *zstd = static_cast<ZstdReader *>(BLI_task_pool_user_data(pool));
+  ZstdReadAheadFrame *slot = static_cast<ZstdReadAheadFrame *>(taskdata);
+
+  /* The frame may have been decompressed by the reading thread already, or the slot may have been
+   * reused for another frame which then gets a task of its own. */
+  BLI_mutex_lock(&zstd->readahead.mutex);
+  if (slot->state != ZSTD_READAHEAD_PENDING) {
+    BLI_mutex_unlock(&zstd->readahead.mutex);
+    return;
+  }
+  slot->state = ZSTD_READAHEAD_RUNNING;
+  BLI_mutex_unlock(&zstd->readahead.mutex);
+
+  zstd_readahead_decompress(slot);
+
+  BLI_mutex_lock(&zstd->readahead.mutex);
+  slot->state = ZSTD_READAHEAD_DONE;
+  BLI_mutex_unlock(&zstd->readahead.mutex);
+  BLI_condition_notify_all(&zstd->readahead.condition);
+}
+
+/* Wait until the slot is not being decompressed anymore, must be called with the mutex locked. */
+static void zstd_readahead_wait_running(ZstdReader *zstd, ZstdReadAheadFrame *slot)
+{
+  while (slot->state == ZSTD_READAHEAD_RUNNING) {
+    BLI_condition_wait(&zstd->readahead.condition, &zstd->readahead.mutex);
+  }
+}
+
+/* Free the data of a slot and mark it as unused, must be called with the mutex locked. */
+static void zstd_readahead_slot_clear(ZstdReader *zstd, ZstdReadAheadFrame *slot)
+{
+  zstd_readahead_wait_running(zstd, slot);
+  MEM_SAFE_FREE(slot->compressed_data);
+  MEM_SAFE_FREE(slot->uncompressed_data);
+  slot->frame = -1;
+  slot->state = ZSTD_READAHEAD_EMPTY;
+}
+
+/**
+ * Get the decompressed content of a frame from the read-ahead slots.
+ *
+ * \return False when the frame was not scheduled for read-ahead, otherwise `r_data` is the
+ * decompressed frame owned by the caller, or null when decompression failed.
+ */
+static bool zstd_readahead_take(ZstdReader *zstd, int frame, char **r_data)
+{
+  if (zstd->readahead.task_pool == nullptr) {
+    return false;
+  }
+
+  BLI_mutex_lock(&zstd->readahead.mutex);
+  for (int i = 0; i < zstd->readahead.frames_num; i++) {
+    ZstdReadAheadFrame *slot = &zstd->readahead.frames[i];
+    if (slot->state == ZSTD_READAHEAD_EMPTY || slot->frame != frame) {
+      continue;
+    }
+    if (slot->state == ZSTD_READAHEAD_PENDING) {
+      /* No worker got to it yet, rather than waiting do the work here. */
+      slot->state = ZSTD_READAHEAD_RUNNING;
+      BLI_mutex_unlock(&zstd->readahead.mutex);
+      zstd_readahead_decompress(slot);
+      BLI_mutex_lock(&zstd->readahead.mutex);
+      slot->state = ZSTD_READAHEAD_DONE;
+    }
+    zstd_readahead_wait_running(zstd, slot);
+
+    *r_data = slot->uncompressed_data;
+    slot->uncompressed_data = nullptr;
+    zstd_readahead_slot_clear(zstd, slot);
+    BLI_mutex_unlock(&zstd->readahead.mutex);
+    return true;
+  }
+  BLI_mutex_unlock(&zstd->readahead.mutex);
+  return false;
+}
+
+/**
+ * Start decompressing the frames following the given one. This only happens when reading moves
+ * forward, seeking back (e.g. for data read on demand) keeps the current read-ahead frames.
+ */
+static void zstd_readahead_schedule(ZstdReader *zstd, int frame)
+{
+  if (zstd->readahead.task_pool == nullptr || frame <= zstd->readahead.front_frame) {
+    return;
+  }
+  zstd->readahead.front_frame = frame;
+
+  const int frame_end = std::min(frame + 1 + zstd->readahead.frames_num, zstd->seek.frames_num);
+
+  BLI_mutex_lock(&zstd->readahead.mutex);
+  /* Frames that were skipped over won't be needed anymore. */
+  for (int i = 0; i < zstd->readahead.frames_num; i++) {
+    ZstdReadAheadFrame *slot = &zstd->readahead.frames[i];
+    if (slot->state != ZSTD_READAHEAD_EMPTY && slot->frame <= frame) {
+      zstd_readahead_slot_clear(zstd, slot);
+    }
+  }
+  BLI_mutex_unlock(&zstd->readahead.mutex);
+
+  /* Only the reading thread changes empty slots, so the mutex doesn't have to be held while
+   * reading from the base file. */
+  for (int next_frame = frame + 1; next_frame < frame_end; next_frame++) {
+    ZstdReadAheadFrame *free_slot = nullptr;
+    bool is_scheduled = false;
+    BLI_mutex_lock(&zstd->readahead.mutex);
+    for (int i = 0; i < zstd->readahead.frames_num; i++) {
+      ZstdReadAheadFrame *slot = &zstd->readahead.frames[i];
+      if (slot->state == ZSTD_READAHEAD_EMPTY) {
+        free_slot = free_slot ? free_slot : slot;
+      }
+      else if (slot->frame == next_frame) {
+        is_scheduled = true;
+        break;
+      }
+    }
+    BLI_mutex_unlock(&zstd->readahead.mutex);
+    if (is_scheduled) {
+      continue;
+    }
+    if (free_slot == nullptr) {
+      break;
+    }
+
+    size_t compressed_size;
+    char *compressed_data = zstd_read_compressed_frame(zstd, next_frame, &compressed_size);
+    if (compressed_data == nullptr) {
+      /* The error is reported when actually reading this frame. */
+      break;
+    }
+    BLI_mutex_lock(&zstd->readahead.mutex);
+    free_slot->frame = next_frame;
+    free_slot->compressed_data = compressed_data;
+    free_slot->compressed_size = compressed_size;
+    free_slot->uncompressed_size = zstd->seek.uncompressed_ofs[next_frame + 1] -
+                                   zstd->seek.uncompressed_ofs[next_frame];
+    free_slot->state = ZSTD_READAHEAD_PENDING;
+    BLI_mutex_unlock(&zstd->readahead.mutex);
+
+    BLI_task_pool_push(
+        zstd->readahead.task_pool, zstd_readahead_task_run, free_slot, false, nullptr);
+  }
+}
+
+static void zstd_readahead_init(ZstdReader *zstd)
+{
+  const int frames_num = std::min(BLI_task_scheduler_num_threads(), ZSTD_READAHEAD_FRAMES_MAX);
+  if (frames_num <= 1 || zstd->seek.frames_num <= 1) {
+    return;
+  }
+  zstd->readahead.frames_num = frames_num;
+  zstd->readahead.front_frame = -1;
+  for (int i = 0; i < frames_num; i++) {
+    zstd->readahead.frames[i].frame = -1;
+  }
+  BLI_mutex_init(&zstd->readahead.mutex);
+  BLI_condition_init(&zstd->readahead.condition);
+  zstd->readahead.task_pool = BLI_task_pool_create(zstd, TASK_PRIORITY_HIGH);
+}
+
+static void zstd_readahead_free(ZstdReader *zstd)
+{
+  if (zstd->readahead.task_pool == nullptr) {
+    return;
+  }
+  /* Frames not being decompressed yet are not needed anymore, tasks that still start return
+   * without doing anything. Cancelling also waits for the running tasks to finish. */
+  BLI_mutex_lock(&zstd->readahead.mutex);
+  for (int i = 0; i < zstd->readahead.frames_num; i++) {
+    ZstdReadAheadFrame *slot = &zstd->readahead.frames[i];
+    if (slot->state == ZSTD_READAHEAD_PENDING) {
+      slot->state = ZSTD_READAHEAD_EMPTY;
+    }
+  }
+  BLI_mutex_unlock(&zstd->readahead.mutex);
+  BLI_task_pool_cancel(zstd->readahead.task_pool);
+  BLI_task_pool_free(zstd->readahead.task_pool);
+  zstd->readahead.task_pool = nullptr;
+  for (int i = 0; i < zstd->readahead.frames_num; i++) {
+    ZstdReadAheadFrame *slot = &zstd->readahead.frames[i];
+    MEM_SAFE_FREE(slot->compressed_data);
+    MEM_SAFE_FREE(slot->uncompressed_data);
+  }
+  BLI_mutex_end(&zstd->readahead.mutex);
+  BLI_condition_end(&zstd->readahead.condition);
+}
+
 /* Ensure that the currently loaded frame is the correct one. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
@@ -164,30 +431,37 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
   /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
   MEM_SAFE_FREE(zstd->seek.cached_content);
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
-
-  char *uncompressed_data = MEM_malloc_arrayN<char>(uncompressed_size, __func__);
-  char *compressed_data = MEM_malloc_arrayN<char>(compressed_size, __func__);
-  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
-      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
-  {
-    MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
-    return nullptr;
+  char *uncompressed_data = nullptr;
+  if (zstd_readahead_take(zstd, frame, &uncompressed_data)) {
+    if (uncompressed_data == nullptr) {
+      return nullptr;
+    }
   }
+  else {
+    size_t compressed_size;
+    char *compressed_data = zstd_read_compressed_frame(zstd, frame, &compressed_size);
+    if (compressed_data == nullptr) {
+      return nullptr;
+    }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
-  MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return nullptr;
+    size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                               zstd->seek.uncompressed_ofs[frame];
+    uncompressed_data = MEM_malloc_arrayN<char>(uncompressed_size, __func__);
+
+    size_t res = ZSTD_decompressDCtx(
+        zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+    MEM_freeN(compressed_data);
+    if (ZSTD_isError(res) || res < uncompressed_size) {
+      MEM_freeN(uncompressed_data);
+      return nullptr;
+    }
   }
 
   zstd->seek.cached_frame = frame;
   zstd->seek.cached_content = uncompressed_data;
+
+  zstd_readahead_schedule(zstd, frame);
+
   return uncompressed_data;
 }
 
@@ -279,6 +553,7 @@ static void zstd_close(FileReader *reader)
 
   ZSTD_freeDCtx(zstd->ctx);
   if (zstd->reader.seek) {
+    zstd_readahead_free(zstd);
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
     /* When an error has occurred this may be nullptr, see: #99744. */
@@ -304,6 +579,7 @@ FileReader *BLI_filereader_new_zstd(FileReader *base)
   if (zstd_read_seek_table(zstd)) {
     zstd->reader.read = zstd_read_seekable;
     zstd->reader.seek = zstd_seek;
+    zstd_readahead_init(zstd);
   }
   else {
     zstd->reader.read = zstd_read;
@@ -460,6 +460,11 @@ static int64_t from_bits_batch_predicate(const IndexMaskSegment universe_segment
     bits::bits_to_index_ranges<int16_t>(bits_slice, builder);
   }
   else {
+    /* Sparse selections leave most segments without any set bit. Those can be skipped without
+     * looking at the individual universe indices. */
+    if (!bits::any_bit_set(bits_slice)) {
+      return segment_start;
+    }
     /* If the universe is not a range, we need to create a new bit span first. In it, bits
      * that are not part of the universe are set to 0. */
     const int64_t segment_end = universe_segment.last() + 1;
@@ -10,6 +10,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -194,9 +195,15 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   node = &nodes[median];
   node->d = axis;
   axis = (axis + 1) % KD_DIMS;
-  node->left = kdtree_balance(nodes, median, axis, ofs);
-  node->right = kdtree_balance(
-      nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+  /* The sub-trees are stored in disjoint ranges of the nodes, so they can be balanced in
+   * parallel. Small trees are balanced on the current thread to avoid the task overhead. */
+  blender::threading::parallel_invoke(
+      nodes_len > 8192,
+      [&]() { node->left = kdtree_balance(nodes, median, axis, ofs); },
+      [&]() {
+        node->right = kdtree_balance(
+            nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+      });
 
   return median + ofs;
 }
@@ -0,0 +1,159 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "BLI_fileops.h"
+#include "BLI_profile.hh"
+#include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+namespace blender::profile {
+
+struct Zone {
+  const char *name;
+  timeit::TimePoint start;
+  timeit::TimePoint end;
+};
+
+/**
+ * The zones of one thread. The mutex is only contended while a trace is started or written, so
+ * recording a zone doesn't have to wait for other threads.
+ */
+struct ThreadZones {
+  std::mutex mutex;
+  int thread_index;
+  Vector<Zone> zones;
+};
+
+struct ProfileState {
+  std::mutex mutex;
+  /** The buffers are never freed, because the threads keep a pointer to theirs. */
+  Vector<std::unique_ptr<ThreadZones>> threads;
+  std::string filepath;
+  timeit::TimePoint start;
+};
+
+static ProfileState &get_state()
+{
+  static ProfileState state;
+  return state;
+}
+
+namespace detail {
+
+std::atomic<bool> is_enabled = false;
+
+static ThreadZones &get_thread_zones()
+{
+  static thread_local ThreadZones *thread_zones = nullptr;
+  if (!thread_zones) {
+    ProfileState &state = get_state();
+    std::lock_guard lock(state.mutex);
+    std::unique_ptr<ThreadZones> new_zones = std::make_unique<ThreadZones>();
+    new_zones->thread_index = int(state.threads.size());
+    thread_zones = new_zones.get();
+    state.threads.append(std::move(new_zones));
+  }
+  return *thread_zones;
+}
+
+void record_zone(const char *name, const timeit::TimePoint start, const timeit::TimePoint end)
+{
+  ThreadZones &thread_zones = get_thread_zones();
+  std::lock_guard lock(thread_zones.mutex);
+  thread_zones.zones.append({name, start, end});
+}
+
+}  // namespace detail
+
+void start(const StringRefNull filepath)
+{
+  ProfileState &state = get_state();
+  std::lock_guard lock(state.mutex);
+  for (std::unique_ptr<ThreadZones> &thread_zones : state.threads) {
+    std::lock_guard thread_lock(thread_zones->mutex);
+    thread_zones->zones.clear();
+  }
+  state.filepath = filepath;
+  state.start = timeit::Clock::now();
+  detail::is_enabled = true;
+}
+
+static void append_escaped(fmt::memory_buffer &buf, const char *str)
+{
+  for (const char *c = str; *c; c++) {
+    if (ELEM(*c, '"', '\\')) {
+      buf.push_back('\\');
+    }
+    buf.push_back(*c);
+  }
+}
+
+void stop()
+{
+  if (!detail::is_enabled.exchange(false)) {
+    return;
+  }
+  ProfileState &state = get_state();
+  std::lock_guard lock(state.mutex);
+
+  /* Times are written in microseconds relative to the start of the trace. */
+  const auto to_us = [&](const timeit::TimePoint time) {
+    return std::chrono::duration<double, std::micro>(time - state.start).count();
+  };
+
+  fmt::memory_buffer buf;
+  buf.append(StringRef("{\"traceEvents\":[\n"));
+  bool is_first = true;
+  for (std::unique_ptr<ThreadZones> &thread_zones : state.threads) {
+    std::lock_guard thread_lock(thread_zones->mutex);
+    for (const Zone &zone : thread_zones->zones) {
+      if (zone.start < state.start) {
+        /* The zone was started before the trace. */
+        continue;
+      }
+      if (!is_first) {
+        buf.append(StringRef(",\n"));
+      }
+      is_first = false;
+      buf.append(StringRef("{\"name\":\""));
+      append_escaped(buf, zone.name);
+      fmt::format_to(fmt::appender(buf),
+                     FMT_STRING("\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+                                "\"pid\":0,\"tid\":{}}}"),
+                     to_us(zone.start),
+                     to_us(zone.end) - to_us(zone.start),
+                     thread_zones->thread_index);
+    }
+    thread_zones->zones.clear_and_shrink();
+  }
+  buf.append(StringRef("\n]}\n"));
+
+  errno = 0;
+  FILE *fp = BLI_fopen(state.filepath.c_str(), "wb");
+  if (fp == nullptr) {
+    fprintf(stderr,
+            "Unable to write profile trace '%s': %s\n",
+            state.filepath.c_str(),
+            errno ? strerror(errno) : "unknown error");
+    return;
+  }
+  fwrite(buf.data(), 1, buf.size(), fp);
+  fclose(fp);
+  printf("Profile trace written to '%s'\n", state.filepath.c_str());
+}
+
+}  // namespace blender::profile
@@ -0,0 +1,74 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_index_mask.hh"
+#include "BLI_math_base.h"
+#include "BLI_spatial_hash_grid.hh"
+#include "BLI_task.hh"
+
+#include "atomic_ops.h"
+
+namespace blender {
+
+SpatialHashGrid::SpatialHashGrid(const Span<float3> positions, const float cell_size)
+    : SpatialHashGrid(positions, positions.index_range(), cell_size)
+{
+}
+
+SpatialHashGrid::SpatialHashGrid(const Span<float3> positions,
+                                 const IndexMask &mask,
+                                 const float cell_size)
+{
+  BLI_assert(cell_size > 0.0f);
+  if (mask.is_empty()) {
+    return;
+  }
+  cell_size_inv_ = 1.0f / cell_size;
+
+  /* About one bucket per point keeps the buckets short without wasting much memory. */
+  const int buckets_num = int(power_of_2_max_u(uint(mask.size())));
+  bucket_mask_ = uint64_t(buckets_num - 1);
+
+  Array<int> point_buckets(mask.size());
+  mask.foreach_index(GrainSize(4096), [&](const int64_t i, const int64_t pos) {
+    point_buckets[pos] = int(this->bucket_of(this->cell_of(positions[i])));
+  });
+
+  bucket_offsets_ = Array<int>(buckets_num + 1, 0);
+  offset_indices::build_reverse_offsets(point_buckets, bucket_offsets_);
+  const OffsetIndices<int> buckets = bucket_offsets_.as_span();
+
+  /* Scatter the points into their buckets. The order within a bucket depends on the threading,
+   * so the buckets are sorted afterwards to make queries deterministic. */
+  indices_.reinitialize(mask.size());
+  int *counts = MEM_calloc_arrayN<int>(size_t(buckets_num), __func__);
+  mask.foreach_index(GrainSize(4096), [&](const int64_t i, const int64_t pos) {
+    const int bucket = point_buckets[pos];
+    const int index_in_bucket = atomic_fetch_and_add_int32(&counts[bucket], 1);
+    indices_[buckets[bucket][index_in_bucket]] = int(i);
+  });
+  MEM_freeN(counts);
+
+  positions_.reinitialize(mask.size());
+  threading::parallel_for(buckets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int64_t bucket : range) {
+      const IndexRange bucket_range = buckets[bucket];
+      MutableSpan<int> bucket_indices = indices_.as_mutable_span().slice(bucket_range);
+      std::sort(bucket_indices.begin(), bucket_indices.end());
+      for (const int i : bucket_range) {
+        positions_[i] = positions[indices_[i]];
+      }
+    }
+  });
+}
+
+}  // namespace blender
@@ -294,7 +294,11 @@ void memory_bandwidth_bound_task_impl(const FunctionRef<void()> function)
    * Additional threads usually have a negligible benefit and can even make performance worse.
    *
    * It's better to use fewer threads here so that the CPU cores can do other tasks at the same
-   * time which may be more compute intensive. */
+   * time which may be more compute intensive.
+   *
+   * NOTE: The arena is not constrained to a NUMA node. The memory touched by these tasks is
+   * usually allocated by other threads, so there is no node that is known to be local to it, and
+   * pinning the arena could just as well increase cross-node traffic. */
   const int num_threads = 8;
   if (num_threads >= BLI_task_scheduler_num_threads()) {
     /* Avoid overhead of using a task arena when it would not have any effect anyway. */
@@ -0,0 +1,106 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <atomic>
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_task.hh"
+
+namespace blender::tests {
+
+template<typename MapT> static void test_add_and_lookup()
+{
+  MapT map;
+  {
+    typename MapT::MutableAccessor accessor;
+    EXPECT_TRUE(map.add(accessor, 5));
+    accessor->second = 10;
+  }
+  {
+    typename MapT::MutableAccessor accessor;
+    EXPECT_FALSE(map.add(accessor, 5));
+    EXPECT_EQ(accessor->second, 10);
+  }
+  {
+    typename MapT::ConstAccessor accessor;
+    EXPECT_TRUE(map.lookup(accessor, 5));
+    EXPECT_EQ(accessor->second, 10);
+  }
+  {
+    typename MapT::ConstAccessor accessor;
+    EXPECT_FALSE(map.lookup(accessor, 6));
+  }
+}
+
+template<typename MapT> static void test_remove()
+{
+  MapT map;
+  {
+    typename MapT::MutableAccessor accessor;
+    map.add(accessor, 3);
+  }
+  EXPECT_TRUE(map.remove(3));
+  EXPECT_FALSE(map.remove(3));
+  typename MapT::ConstAccessor accessor;
+  EXPECT_FALSE(map.lookup(accessor, 3));
+}
+
+template<typename MapT> static void test_add_from_many_threads()
+{
+  MapT map;
+  std::atomic<int> newly_added_num = 0;
+  /* Every key is added by multiple threads, only one of them must see it as newly added. */
+  threading::parallel_for(IndexRange(100000), 128, [&](const IndexRange range) {
+    for (const int i : range) {
+      typename MapT::MutableAccessor accessor;
+      if (map.add(accessor, i % 1000)) {
+        newly_added_num++;
+      }
+      accessor->second++;
+    }
+  });
+  EXPECT_EQ(newly_added_num.load(), 1000);
+  for (const int key : IndexRange(1000)) {
+    typename MapT::ConstAccessor accessor;
+    EXPECT_TRUE(map.lookup(accessor, key));
+    EXPECT_EQ(accessor->second, 100);
+  }
+}
+
+/** The implementation that is used when TBB is not available. */
+using FallbackMap = concurrent_map_detail::ShardedMap<int, int>;
+
+TEST(concurrent_map, AddAndLookup)
+{
+  test_add_and_lookup<ConcurrentMap<int, int>>();
+}
+
+TEST(concurrent_map, Remove)
+{
+  test_remove<ConcurrentMap<int, int>>();
+}
+
+TEST(concurrent_map, AddFromManyThreads)
+{
+  test_add_from_many_threads<ConcurrentMap<int, int>>();
+}
+
+TEST(concurrent_map, FallbackAddAndLookup)
+{
+  test_add_and_lookup<FallbackMap>();
+}
+
+TEST(concurrent_map, FallbackRemove)
+{
+  test_remove<FallbackMap>();
+}
+
+TEST(concurrent_map, FallbackAddFromManyThreads)
+{
+  test_add_from_many_threads<FallbackMap>();
+}
+
+}  // namespace blender::tests
@@ -148,6 +148,8 @@ TEST_CONST(Half, ".5", 0.5)
 TEST_CONST(Pi, "pi", M_PI)
 TEST_CONST(True, "True", TRUE_VAL)
 TEST_CONST(False, "False", FALSE_VAL)
+TEST_CONST(E, "e", M_E)
+TEST_CONST(Tau, "tau", 2.0 * M_PI)
 
 TEST_CONST(Sqrt, "sqrt(4)", 2.0)
 TEST_EVAL(Sqrt, "sqrt(x)", 4.0, 2.0)
@@ -159,6 +161,23 @@ TEST_CONST(Pow, "pow(4, 0.5)", 2.0)
 TEST_EVAL(Pow, "pow(4, x)", 0.5, 2.0)
 
 TEST_CONST(Log2_1, "log(4, 2)", 2.0)
+TEST_CONST(Log2_2, "log2(8)", 3.0)
+TEST_CONST(Log10, "log10(1000)", 3.0)
+
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_CONST(CopySign, "copysign(2, -1)", -2.0)
+TEST_CONST(Tanh, "tanh(0)", 0.0)
+TEST_CONST(Asinh, "asinh(0)", 0.0)
+TEST_CONST(Acosh, "acosh(1)", 0.0)
+TEST_CONST(Atanh, "atanh(0)", 0.0)
+TEST_CONST(Expm1, "expm1(0)", 0.0)
+TEST_CONST(Log1p, "log1p(0)", 0.0)
+
+TEST_CONST(Bool1, "bool(0)", FALSE_VAL)
+TEST_CONST(Bool2, "bool(-0.5)", TRUE_VAL)
+TEST_EVAL(Bool, "bool(x)", 2.0, TRUE_VAL)
+TEST_CONST(Float, "float(2)", 2.0)
+TEST_EVAL(Float, "float(x) / 4", 1.0, 0.25)
 
 TEST_CONST(Round1, "round(-0.5)", -1.0)
 TEST_CONST(Round2, "round(-0.4)", 0.0)
@@ -208,6 +227,23 @@ TEST_EVAL(BinaryMul, "x*3", 2, 6.0)
 TEST_CONST(BinaryDiv, "3/2", 1.5)
 TEST_EVAL(BinaryDiv, "3/x", 2, 1.5)
 
+TEST_CONST(BinaryFloorDiv1, "7//2", 3.0)
+TEST_CONST(BinaryFloorDiv2, "-7//2", -4.0)
+TEST_EVAL(BinaryFloorDiv, "x//2", -7, -4.0)
+
+TEST_CONST(BinaryMod1, "7%3", 1.0)
+TEST_CONST(BinaryMod2, "-7%3", 2.0)
+TEST_CONST(BinaryMod3, "7%-3", -2.0)
+TEST_CONST(BinaryMod4, "7.5%2", 1.5)
+TEST_EVAL(BinaryMod, "x%3", -7, 2.0)
+
+TEST_CONST(BinaryPow1, "2**3", 8.0)
+TEST_CONST(BinaryPow2, "2**-1", 0.5)
+TEST_CONST(BinaryPow3, "-2**2", -4.0)
+TEST_CONST(BinaryPow4, "2**3**2", 512.0)
+TEST_CONST(BinaryPow5, "2*3**2", 18.0)
+TEST_EVAL(BinaryPow, "x**2", 3, 9.0)
+
 TEST_CONST(Arith1, "1 + -2 * 3", -5.0)
 TEST_CONST(Arith2, "(1 + -2) * 3", -3.0)
 TEST_CONST(Arith3, "-1 + 2 * 3", 5.0)
@@ -332,6 +368,9 @@ TEST_ERROR(DivZero1, "0 / 0", 0.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(DivZero2, "1 / 0", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
 TEST_ERROR(DivZero3, "1 / x", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
 TEST_ERROR(DivZero4, "1 / x", 1.0, EXPR_PYLIKE_SUCCESS)
+TEST_ERROR(DivZero5, "1 // x", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
+TEST_ERROR(DivZero6, "1 % x", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
+TEST_ERROR(DivZero7, "x ** -1", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
 
 TEST_ERROR(SqrtDomain1, "sqrt(-1)", 0.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(SqrtDomain2, "sqrt(x)", -1.0, EXPR_PYLIKE_MATH_ERROR)
@@ -341,6 +380,8 @@ TEST_ERROR(PowDomain1, "pow(-1, 0.5)", 0.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(PowDomain2, "pow(-1, x)", 0.5, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(PowDomain3, "pow(-1, x)", 2.0, EXPR_PYLIKE_SUCCESS)
 
+TEST_ERROR(AcoshDomain, "acosh(x)", 0.5, EXPR_PYLIKE_MATH_ERROR)
+
 TEST_ERROR(Mixed1, "sqrt(x) + 1 / max(0, x)", -1.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(Mixed2, "sqrt(x) + 1 / max(0, x)", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
 TEST_ERROR(Mixed3, "sqrt(x) + 1 / max(0, x)", 1.0, EXPR_PYLIKE_SUCCESS)
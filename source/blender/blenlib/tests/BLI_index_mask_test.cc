@@ -78,6 +78,21 @@ TEST(index_mask, FromBitsWithUniverse)
   EXPECT_EQ(mask[5], 102);
 }
 
+TEST(index_mask, FromBitsSparseWithUniverse)
+{
+  IndexMaskMemory memory;
+  BitVector bit_vec(100'000, false);
+  bit_vec[50'002].set();
+  bit_vec[50'003].set();
+
+  /* Every second index, so that the universe segments are not ranges. */
+  const IndexMask universe = IndexMask::from_predicate(
+      IndexRange(100'000), GrainSize(1024), memory, [](const int64_t i) { return i % 2 == 0; });
+  const IndexMask mask = IndexMask::from_bits(universe, bit_vec, memory);
+  EXPECT_EQ(mask.size(), 1);
+  EXPECT_EQ(mask[0], 50'002);
+}
+
 TEST(index_mask, FromBitsSparse)
 {
   BitVector bit_vec(100'000, false);
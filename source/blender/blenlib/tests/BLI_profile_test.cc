@@ -0,0 +1,63 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_fileops.h"
+#include "BLI_path_utils.hh"
+#include "BLI_profile.hh"
+#include "BLI_string_ref.hh"
+#include "BLI_task.hh"
+#include "BLI_tempfile.h"
+
+namespace blender::tests {
+
+static std::string read_trace(const std::string &filepath)
+{
+  size_t size = 0;
+  char *data = static_cast<char *>(BLI_file_read_text_as_mem(filepath.c_str(), 0, &size));
+  if (data == nullptr) {
+    return "";
+  }
+  std::string text(data, size);
+  MEM_freeN(data);
+  return text;
+}
+
+TEST(profile, WritesZones)
+{
+  char temp_dir[FILE_MAX];
+  BLI_temp_directory_path_get(temp_dir, sizeof(temp_dir));
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), temp_dir, "blender_profile_test.json");
+
+  {
+    BLI_PROFILE_SCOPE("Not Recorded");
+  }
+  EXPECT_FALSE(profile::is_enabled());
+
+  profile::start(filepath);
+  EXPECT_TRUE(profile::is_enabled());
+  {
+    BLI_PROFILE_SCOPE("Outer \"Zone\"");
+    threading::parallel_for(IndexRange(100), 1, [&](const IndexRange /*range*/) {
+      BLI_PROFILE_SCOPE("Inner Zone");
+    });
+  }
+  profile::stop();
+  EXPECT_FALSE(profile::is_enabled());
+
+  const std::string trace = read_trace(filepath);
+  BLI_delete(filepath, false, false);
+
+  const StringRef trace_ref = trace;
+  EXPECT_TRUE(trace_ref.startswith("{\"traceEvents\":["));
+  EXPECT_NE(trace_ref.find("\"name\":\"Outer \\\"Zone\\\"\""), StringRef::not_found);
+  EXPECT_NE(trace_ref.find("\"name\":\"Inner Zone\""), StringRef::not_found);
+  EXPECT_EQ(trace_ref.find("Not Recorded"), StringRef::not_found);
+}
+
+}  // namespace blender::tests
@@ -0,0 +1,72 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_rand.hh"
+#include "BLI_spatial_hash_grid.hh"
+
+namespace blender::tests {
+
+TEST(spatial_hash_grid, Empty)
+{
+  const SpatialHashGrid grid({}, 1.0f);
+  EXPECT_TRUE(grid.is_empty());
+  int found = 0;
+  grid.foreach_in_radius(float3(0.0f), 10.0f, [&](const int /*index*/, const float /*dist_sq*/) {
+    found++;
+  });
+  EXPECT_EQ(found, 0);
+}
+
+TEST(spatial_hash_grid, MatchesBruteForce)
+{
+  RandomNumberGenerator rng(42);
+  Array<float3> positions(5000);
+  for (float3 &position : positions) {
+    position = float3(rng.get_float(), rng.get_float(), rng.get_float()) * 10.0f - 5.0f;
+  }
+
+  for (const float cell_size : {0.3f, 1.0f, 20.0f}) {
+    const SpatialHashGrid grid(positions, cell_size);
+    for (const int query : IndexRange(50)) {
+      const float3 co = positions[query * 97];
+      const float radius = 0.5f + 0.05f * query;
+
+      Vector<int> expected;
+      for (const int i : positions.index_range()) {
+        if (math::distance_squared(co, positions[i]) < radius * radius) {
+          expected.append(i);
+        }
+      }
+
+      Vector<int> found;
+      grid.foreach_in_radius(co, radius, [&](const int index, const float dist_sq) {
+        EXPECT_FLOAT_EQ(dist_sq, math::distance_squared(co, positions[index]));
+        found.append(index);
+      });
+      std::sort(found.begin(), found.end());
+      EXPECT_EQ_SPAN<int>(expected, found);
+    }
+  }
+}
+
+TEST(spatial_hash_grid, LargeCoordinates)
+{
+  /* The cell coordinates of these are outside of the integer range. */
+  const Array<float3> positions = {float3(1e30f), float3(-1e30f), float3(0.0f)};
+  const SpatialHashGrid grid(positions, 0.01f);
+
+  Vector<int> found;
+  grid.foreach_in_radius(
+      float3(0.0f), 1.0f, [&](const int index, const float /*dist_sq*/) { found.append(index); });
+  EXPECT_EQ_SPAN<int>(Span<int>({2}), found);
+
+  found.clear();
+  grid.foreach_in_radius(
+      float3(1e30f), 1.0f, [&](const int index, const float /*dist_sq*/) { found.append(index); });
+  EXPECT_EQ_SPAN<int>(Span<int>({0}), found);
+}
+
+}  // namespace blender::tests
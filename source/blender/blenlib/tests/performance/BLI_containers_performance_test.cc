@@ -0,0 +1,188 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <atomic>
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_map.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_rand.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector_set.hh"
+#include "BLI_virtual_array.hh"
+
+/**
+ * Timings for hot containers and threading primitives, to catch performance regressions. The
+ * results are printed by #SCOPED_TIMER, the tests only check that the work was not optimized
+ * away.
+ */
+
+namespace blender::tests {
+
+static constexpr int elements_num = 10'000'000;
+
+static Array<int> random_ints(const int size, const int max)
+{
+  Array<int> values(size);
+  RandomNumberGenerator rng(0);
+  for (int &value : values) {
+    value = rng.get_int32(max);
+  }
+  return values;
+}
+
+TEST(containers_performance, Map)
+{
+  const Array<int> keys = random_ints(elements_num, elements_num);
+  Map<int, int> map;
+  {
+    SCOPED_TIMER("map_add");
+    for (const int i : keys.index_range()) {
+      map.add(keys[i], i);
+    }
+  }
+  int64_t found_num = 0;
+  {
+    SCOPED_TIMER("map_lookup");
+    for (const int key : keys) {
+      found_num += map.contains(key);
+    }
+  }
+  EXPECT_EQ(found_num, elements_num);
+}
+
+TEST(containers_performance, Set)
+{
+  const Array<int> keys = random_ints(elements_num, elements_num);
+  Set<int> set;
+  {
+    SCOPED_TIMER("set_add");
+    for (const int key : keys) {
+      set.add(key);
+    }
+  }
+  int64_t found_num = 0;
+  {
+    SCOPED_TIMER("set_lookup");
+    for (const int key : keys) {
+      found_num += set.contains(key);
+    }
+  }
+  EXPECT_EQ(found_num, elements_num);
+}
+
+TEST(containers_performance, VectorSet)
+{
+  const Array<int> keys = random_ints(elements_num, elements_num);
+  VectorSet<int> vector_set;
+  {
+    SCOPED_TIMER("vector_set_add");
+    for (const int key : keys) {
+      vector_set.add(key);
+    }
+  }
+  int64_t index_sum = 0;
+  {
+    SCOPED_TIMER("vector_set_index_of");
+    for (const int key : keys) {
+      index_sum += vector_set.index_of(key);
+    }
+  }
+  EXPECT_GE(index_sum, 0);
+}
+
+TEST(containers_performance, IndexMask)
+{
+  const Array<int> values = random_ints(elements_num, 100);
+  IndexMaskMemory memory;
+  IndexMask mask;
+  {
+    SCOPED_TIMER("index_mask_from_predicate");
+    mask = IndexMask::from_predicate(
+        IndexRange(elements_num), GrainSize(4096), memory, [&](const int64_t i) {
+          return values[i] < 50;
+        });
+  }
+  std::atomic<int64_t> sum = 0;
+  {
+    SCOPED_TIMER("index_mask_foreach_index");
+    mask.foreach_index(GrainSize(4096), [&](const int64_t i) {
+      if (values[i] == 0) {
+        sum.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  EXPECT_GT(mask.size(), 0);
+  EXPECT_GE(sum.load(), 0);
+}
+
+TEST(containers_performance, VArrayDevirtualize)
+{
+  const Array<int> values = random_ints(elements_num, 100);
+  const VArray<int> varray = VArray<int>::ForSpan(values);
+  int64_t sum_virtual = 0;
+  {
+    SCOPED_TIMER("varray_virtual_get");
+    for (const int64_t i : varray.index_range()) {
+      sum_virtual += varray[i];
+    }
+  }
+  int64_t sum_devirtualized = 0;
+  {
+    SCOPED_TIMER("varray_devirtualized");
+    devirtualize_varray(varray, [&](const auto &varray) {
+      for (const int64_t i : values.index_range()) {
+        sum_devirtualized += varray[i];
+      }
+    });
+  }
+  EXPECT_EQ(sum_virtual, sum_devirtualized);
+}
+
+TEST(containers_performance, ParallelForOverhead)
+{
+  Array<int> values(elements_num, 0);
+  {
+    SCOPED_TIMER("parallel_for_grain_1");
+    threading::parallel_for(IndexRange(100'000), 1, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i]++;
+      }
+    });
+  }
+  {
+    SCOPED_TIMER("parallel_for_grain_4096");
+    threading::parallel_for(values.index_range(), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i]++;
+      }
+    });
+  }
+  EXPECT_EQ(values[0], 2);
+}
+
+TEST(containers_performance, OffsetIndices)
+{
+  const Array<int> counts = random_ints(elements_num, 8);
+  Array<int> offsets(elements_num + 1);
+  offsets.as_mutable_span().drop_back(1).copy_from(counts);
+  OffsetIndices<int> offset_indices;
+  {
+    SCOPED_TIMER("offset_indices_accumulate");
+    offset_indices = offset_indices::accumulate_counts_to_offsets(offsets);
+  }
+  Array<int> sizes(elements_num);
+  {
+    SCOPED_TIMER("offset_indices_copy_group_sizes");
+    offset_indices::copy_group_sizes(offset_indices, offset_indices.index_range(), sizes);
+  }
+  EXPECT_EQ(sizes.as_span(), counts.as_span());
+}
+
+}  // namespace blender::tests
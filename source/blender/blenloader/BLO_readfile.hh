@@ -17,6 +17,7 @@
 
 struct AssetMetaData;
 struct BHead;
+struct BlendFileIndex;
 struct BlendfileLinkAppendContext;
 struct BlendHandle;
 struct BlendThumbnail;
@@ -284,6 +285,27 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
 
                                               bool use_assets_only,
                                               int *r_tot_names);
+/**
+ * Read the cached data-blocks index of the given file, creating or updating it when needed. The
+ * data-blocks of the file are listed once and cached in the user cache directory, later calls for
+ * the same unchanged file only read that index instead of opening the file.
+ *
+ * \param filepath: The absolute path of the file to list.
+ * \param reports: Report errors in opening the file (can be NULL).
+ * \return The index, to be freed with #BLO_blendfile_index_free, or null if the file could not
+ * be read.
+ */
+BlendFileIndex *BLO_blendfile_index_read(const char *filepath, BlendFileReadReport *reports);
+/**
+ * Same as #BLO_blendhandle_get_datablock_names, but from the index of a file.
+ *
+ * \return A BLI_linklist of strings. The string links should be freed with #MEM_freeN().
+ */
+LinkNode *BLO_blendfile_index_get_datablock_names(const BlendFileIndex *index,
+                                                  int ofblocktype,
+                                                  bool use_assets_only,
+                                                  int *r_tot_names);
+void BLO_blendfile_index_free(BlendFileIndex *index);
 /**
  * Gets the names and asset-data (if ID is an asset) of data-blocks in a file of a certain type.
  * The data-blocks can be limited to assets.
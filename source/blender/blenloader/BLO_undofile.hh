@@ -31,9 +31,14 @@ struct MemFileSharedStorage {
 struct MemFileChunk {
   void *next, *prev;
   const char *buf;
+  /**
+   * Owns #buf, which is shared by all the chunks of the undo stack with the same content (not only
+   * the ones of consecutive steps).
+   */
+  const blender::ImplicitSharingInfo *buf_sharing_info;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** When true, this chunk is identical to the matching one in the previous step. */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
@@ -98,11 +103,6 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 /* **************** support for memory-write, for undo buffers *************** */
 
 void BLO_memfile_free(MemFile *memfile);
-/**
- * Result is that 'first' is being freed.
- * To keep the #MemFile linked list of consistent, `first` is always first in list.
- */
-void BLO_memfile_merge(MemFile *first, MemFile *second);
 /**
  * Clear is_identical_future before adding next memfile.
  */
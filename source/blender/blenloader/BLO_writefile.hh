@@ -44,6 +44,32 @@ struct BlendFileWriteParams {
   /** On write, restore paths after editing them (see #BLO_WRITE_PATH_REMAP_RELATIVE). */
   uint use_save_as_copy : 1;
   uint use_userdef : 1;
+  /**
+   * When compressing, reuse the compressed data of the previous save done with this option for
+   * content that did not change. Meant for repeated saves of the same data (auto-save), where the
+   * compression dominates the cost of writing the file.
+   */
+  uint use_compression_cache : 1;
+  /**
+   * Only serialize the data on the calling thread, compression and file writing are done in a
+   * background thread (see #BLO_write_file_background_wait). This keeps the whole uncompressed
+   * file in memory until it is written, and errors are only reported in the console.
+   *
+   * Not supported together with path remapping and save versions, the file is written directly in
+   * that case.
+   */
+  uint use_background_write : 1;
+  /**
+   * Zstd compression level used for compressed files (see #G_FILE_COMPRESS), zero for the default.
+   * Higher levels give smaller files but take longer to write.
+   */
+  int compression_level;
+  /**
+   * Size in bytes of the chunks the file is written in, zero for the default (1 MB). When
+   * compressing each chunk is compressed separately, larger chunks compress better, smaller ones
+   * allow reading parts of the file with less memory.
+   */
+  int write_chunk_size;
   const BlendThumbnail *thumb;
 };
 
@@ -61,4 +87,14 @@ extern bool BLO_write_file(Main *mainvar,
  */
 extern bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, int write_flags);
 
+/**
+ * Wait until files written with #BlendFileWriteParams.use_background_write are on disk.
+ */
+void BLO_write_file_background_wait();
+
+/**
+ * Free the data kept by writes using #BlendFileWriteParams.use_compression_cache.
+ */
+void BLO_write_compression_cache_free();
+
 /** \} */
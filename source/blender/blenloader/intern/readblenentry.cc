@@ -7,20 +7,35 @@
  * `.blend` file reading entry point.
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+
+#include <fmt/format.h>
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_fileops.h"
+#include "BLI_fileops_types.h"
 #include "BLI_ghash.h"
+#include "BLI_hash.hh"
 #include "BLI_linklist.h"
-#include "BLI_path_utils.hh" /* Only for assertions. */
+#include "BLI_path_utils.hh"
+#include "BLI_profile.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+/* For S_ISREG() on Windows. */
+#ifdef WIN32
+#  include "BLI_winstuff.h"
+#endif
 
 #include "DNA_genfile.h"
 
+#include "BKE_appdir.hh"
 #include "BKE_asset.hh"
 #include "BKE_idtype.hh"
 #include "BKE_main.hh"
@@ -107,6 +122,264 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
   return names;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Data-Block Names Index
+ *
+ * Listing the data-blocks of a file requires reading all of its block headers (and decompressing
+ * the whole file when it is compressed). The result of that scan is stored in the user cache
+ * directory, so that listing unchanged library files does not need to open them at all.
+ *
+ * The index file stores a small header, used to validate it against the size and modification
+ * time of the `.blend` file, followed by one entry per data-block.
+ * \{ */
+
+#define BLEND_INDEX_IDENTIFIER "BLENDIDX"
+#define BLEND_INDEX_VERSION 1
+/** Number of index files kept, the least recently written ones are removed. */
+#define BLEND_INDEX_FILES_MAX 1000
+
+struct BlendIndexHeader {
+  char identifier[8];
+  uint32_t version;
+  uint32_t entries_num;
+  uint64_t file_size;
+  int64_t file_mtime;
+};
+
+struct BlendIndexEntry {
+  short code;
+  bool is_asset;
+  std::string name;
+};
+
+struct BlendFileIndex {
+  blender::Vector<BlendIndexEntry> entries;
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("BlendFileIndex")
+};
+
+static void blend_index_dir_get(char *r_dirpath, const size_t dirpath_maxncpy)
+{
+  BKE_appdir_folder_caches(r_dirpath, dirpath_maxncpy);
+  BLI_path_append(r_dirpath, dirpath_maxncpy, "blend-file-indices");
+}
+
+/**
+ * `BKE_appdir_folder_caches/blend-file-indices/{filepath_hash}_{filename}.index`.
+ */
+static std::string blend_index_filepath(const char *filepath)
+{
+  char index_path[FILE_MAX];
+  blend_index_dir_get(index_path, sizeof(index_path));
+  const std::string filename = fmt::format("{:016x}_{}.index",
+                                           blender::get_default_hash(blender::StringRef(filepath)),
+                                           BLI_path_basename(filepath));
+  BLI_path_append(index_path, sizeof(index_path), filename.c_str());
+  return index_path;
+}
+
+static bool blend_index_read(const char *index_path,
+                             const BLI_stat_t &file_stat,
+                             blender::Vector<BlendIndexEntry> &r_entries)
+{
+  FILE *file = BLI_fopen(index_path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool is_valid = false;
+  BlendIndexHeader header;
+  if (fread(&header, sizeof(header), 1, file) == 1 &&
+      memcmp(header.identifier, BLEND_INDEX_IDENTIFIER, sizeof(header.identifier)) == 0 &&
+      header.version == BLEND_INDEX_VERSION && header.file_size == uint64_t(file_stat.st_size) &&
+      header.file_mtime == int64_t(file_stat.st_mtime))
+  {
+    is_valid = true;
+    r_entries.reserve(header.entries_num);
+    for (uint32_t i = 0; i < header.entries_num; i++) {
+      int16_t code;
+      uint8_t is_asset;
+      uint8_t name_len;
+      if (fread(&code, sizeof(code), 1, file) != 1 ||
+          fread(&is_asset, sizeof(is_asset), 1, file) != 1 ||
+          fread(&name_len, sizeof(name_len), 1, file) != 1)
+      {
+        is_valid = false;
+        break;
+      }
+      std::string name(name_len, '\0');
+      if (name_len && fread(name.data(), name_len, 1, file) != 1) {
+        is_valid = false;
+        break;
+      }
+      r_entries.append({code, is_asset != 0, std::move(name)});
+    }
+  }
+  fclose(file);
+
+  if (!is_valid) {
+    r_entries.clear();
+  }
+  return is_valid;
+}
+
+static void blend_index_write(const char *index_path,
+                              const BLI_stat_t &file_stat,
+                              const blender::Span<BlendIndexEntry> entries)
+{
+  if (!BLI_file_ensure_parent_dir_exists(index_path)) {
+    return;
+  }
+  /* Write to a temporary file first, other instances may read the index at the same time. */
+  const std::string index_path_temp = fmt::format("{}@", index_path);
+  FILE *file = BLI_fopen(index_path_temp.c_str(), "wb");
+  if (file == nullptr) {
+    return;
+  }
+
+  BlendIndexHeader header{};
+  memcpy(header.identifier, BLEND_INDEX_IDENTIFIER, sizeof(header.identifier));
+  header.version = BLEND_INDEX_VERSION;
+  header.entries_num = uint32_t(entries.size());
+  header.file_size = uint64_t(file_stat.st_size);
+  header.file_mtime = int64_t(file_stat.st_mtime);
+
+  bool is_ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  for (const BlendIndexEntry &entry : entries) {
+    if (!is_ok) {
+      break;
+    }
+    const int16_t code = entry.code;
+    const uint8_t is_asset = entry.is_asset;
+    const uint8_t name_len = uint8_t(entry.name.size());
+    is_ok = fwrite(&code, sizeof(code), 1, file) == 1 &&
+            fwrite(&is_asset, sizeof(is_asset), 1, file) == 1 &&
+            fwrite(&name_len, sizeof(name_len), 1, file) == 1 &&
+            (name_len == 0 || fwrite(entry.name.data(), name_len, 1, file) == 1);
+  }
+  is_ok &= fclose(file) == 0;
+
+  if (!is_ok || BLI_rename_overwrite(index_path_temp.c_str(), index_path) != 0) {
+    BLI_delete(index_path_temp.c_str(), false, false);
+  }
+}
+
+/** Remove the least recently written index files, so the cache doesn't grow without bounds. */
+static void blend_index_dir_prune()
+{
+  char dirpath[FILE_MAX];
+  blend_index_dir_get(dirpath, sizeof(dirpath));
+  direntry *files;
+  const uint files_num = BLI_filelist_dir_contents(dirpath, &files);
+
+  blender::Vector<const direntry *> index_files;
+  for (const direntry &file : blender::Span(files, files_num)) {
+    if (S_ISREG(file.type) && BLI_path_extension_check(file.relname, ".index")) {
+      index_files.append(&file);
+    }
+  }
+  if (index_files.size() > BLEND_INDEX_FILES_MAX) {
+    std::sort(index_files.begin(), index_files.end(), [](const direntry *a, const direntry *b) {
+      return a->s.st_mtime > b->s.st_mtime;
+    });
+    for (const direntry *file : index_files.as_span().drop_front(BLEND_INDEX_FILES_MAX)) {
+      BLI_delete(file->path, false, false);
+    }
+  }
+  BLI_filelist_free(files, files_num);
+}
+
+static blender::Vector<BlendIndexEntry> blend_index_entries_from_handle(FileData *fd)
+{
+  blender::Vector<BlendIndexEntry> entries;
+  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == BLO_CODE_ENDB) {
+      break;
+    }
+    if (!blo_bhead_is_id_valid_type(bhead)) {
+      continue;
+    }
+    const char *idname = blo_bhead_id_name(fd, bhead);
+    if (!idname) {
+      continue;
+    }
+    const bool is_asset = blo_bhead_id_asset_data_address(fd, bhead) != nullptr;
+    entries.append({short(bhead->code), is_asset, idname + 2});
+  }
+  return entries;
+}
+
+/**
+ * Get the data-blocks index entries of the given file, creating or updating the index when
+ * needed.
+ */
+static bool blend_index_entries_ensure(const char *filepath,
+                                       BlendFileReadReport *reports,
+                                       blender::Vector<BlendIndexEntry> &r_entries)
+{
+  BLI_stat_t file_stat;
+  if (BLI_stat(filepath, &file_stat) != 0) {
+    return false;
+  }
+
+  const std::string index_path = blend_index_filepath(filepath);
+  if (blend_index_read(index_path.c_str(), file_stat, r_entries)) {
+    return true;
+  }
+
+  FileData *fd = blo_filedata_from_file(filepath, reports);
+  if (fd == nullptr) {
+    return false;
+  }
+  r_entries = blend_index_entries_from_handle(fd);
+  blo_filedata_free(fd);
+
+  /* The modification time only has a resolution of a second. A file that was changed within the
+   * last seconds may still change again with the same time and size, so it isn't indexed yet. */
+  if (int64_t(file_stat.st_mtime) + 2 < int64_t(time(nullptr))) {
+    blend_index_write(index_path.c_str(), file_stat, r_entries);
+    blend_index_dir_prune();
+  }
+  return true;
+}
+
+BlendFileIndex *BLO_blendfile_index_read(const char *filepath, BlendFileReadReport *reports)
+{
+  BlendFileIndex *index = MEM_new<BlendFileIndex>(__func__);
+  if (!blend_index_entries_ensure(filepath, reports, index->entries)) {
+    MEM_delete(index);
+    return nullptr;
+  }
+  return index;
+}
+
+LinkNode *BLO_blendfile_index_get_datablock_names(const BlendFileIndex *index,
+                                                  const int ofblocktype,
+                                                  const bool use_assets_only,
+                                                  int *r_tot_names)
+{
+  LinkNode *names = nullptr;
+  int tot = 0;
+
+  for (const BlendIndexEntry &entry : index->entries) {
+    if (entry.code != ofblocktype || (use_assets_only && !entry.is_asset)) {
+      continue;
+    }
+    BLI_linklist_prepend(&names, BLI_strdupn(entry.name.data(), entry.name.size()));
+    tot++;
+  }
+
+  *r_tot_names = tot;
+  return names;
+}
+
+void BLO_blendfile_index_free(BlendFileIndex *index)
+{
+  MEM_delete(index);
+}
+
+/** \} */
+
 LinkNode *BLO_blendhandle_get_datablock_info(BlendHandle *bh,
                                              int ofblocktype,
                                              const bool use_assets_only,
@@ -305,6 +578,7 @@ BlendFileData *BLO_read_from_file(const char *filepath,
                                   eBLOReadSkip skip_flags,
                                   BlendFileReadReport *reports)
 {
+  BLI_PROFILE_SCOPE("Read Blend File");
   BLI_assert(!BLI_path_is_rel(filepath));
   BLI_assert(BLI_path_is_abs_from_cwd(filepath));
 
@@ -56,9 +56,11 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -493,7 +495,7 @@ static bool blo_bhead_is_id(const BHead *bhead)
   return bhead->code <= 0xFFFF;
 }
 
-static bool blo_bhead_is_id_valid_type(const BHead *bhead)
+bool blo_bhead_is_id_valid_type(const BHead *bhead)
 {
   if (!blo_bhead_is_id(bhead)) {
     return false;
@@ -809,6 +811,33 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
   }
   return &new_bhead_data->bhead;
 }
+
+/**
+ * When the file is memory-backed (typically memory-mapped), give direct access to the data of a
+ * block that has not been read yet. This avoids reading a temporary copy of blocks that have to
+ * be converted anyway.
+ *
+ * \return nullptr when the data is not available in memory, or not aligned for the struct
+ * stored in it. #blo_bhead_read_full must be used then.
+ */
+static const void *blo_bhead_data_in_place(FileData *fd, BHead *thisblock)
+{
+  const BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  size_t length;
+  const char *memory = static_cast<const char *>(BLI_filereader_memory_data(fd->file, &length));
+  if (memory == nullptr || size_t(new_bhead->file_offset) + size_t(thisblock->len) > length) {
+    return nullptr;
+  }
+  const char *data = memory + new_bhead->file_offset;
+  /* Struct reconstruction reads members through typed pointers, blocks in the file are not
+   * necessarily aligned for them. */
+  const int alignment = DNA_struct_alignment(fd->filesdna, thisblock->SDNAnr);
+  if (uintptr_t(data) % uintptr_t(alignment) != 0) {
+    return nullptr;
+  }
+  return data;
+}
 #endif /* USE_BHEAD_READ_ON_DEMAND */
 
 const char *blo_bhead_id_name(FileData *fd, const BHead *bhead)
@@ -1884,17 +1913,29 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
     if (fd->compflags[bh->SDNAnr] != SDNA_CMP_REMOVED) {
       const char *alloc_name = get_alloc_name(fd, bh, blockname, id_type_index);
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+        const void *data = bh + 1;
+        bool is_data_in_place = false;
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
-          bh = blo_bhead_read_full(fd, bh);
-          if (UNLIKELY(bh == nullptr)) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
-            return nullptr;
+          if (const void *data_in_place = blo_bhead_data_in_place(fd, bh)) {
+            data = data_in_place;
+            is_data_in_place = true;
+          }
+          else {
+            bh = blo_bhead_read_full(fd, bh);
+            if (UNLIKELY(bh == nullptr)) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              return nullptr;
+            }
+            data = bh + 1;
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(
-            fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1), alloc_name);
+        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data, alloc_name);
+        if (is_data_in_place && UNLIKELY(BLI_filereader_memory_any_io_error(fd->file))) {
+          fd->flags &= ~FD_FLAGS_FILE_OK;
+          MEM_SAFE_FREE(temp);
+        }
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -2626,29 +2667,163 @@ static bool direct_link_id(FileData *fd,
   return success;
 }
 
-/* Read all data associated with a datablock into datamap. */
+/**
+ * A data block of an ID whose content is already in memory, and only needs to be converted to the
+ * current DNA (or copied as is) to get its run-time data.
+ */
+struct DataBlockReadTask {
+  /** The block as found in the #FileData bhead list, its `old` address is the datamap key. */
+  BHead *bhead;
+  /** Block holding the data, differs from #bhead when its content had to be read on demand. */
+  BHead *bhead_data;
+  /** The data to convert, either following #bhead_data or directly in the file memory. */
+  const void *data_src;
+  const char *alloc_name;
+  bool needs_reconstruct;
+  void *data;
+};
+
+/**
+ * Prepare reading the data of a block in parallel. All file access and #FileData modifications
+ * are done here, so that only thread-safe DNA conversion and memory copies remain for
+ * #data_block_read_task_exec.
+ *
+ * \return false when the block cannot be converted in parallel (it is then read directly, and
+ * the result is stored in `r_task.data`).
+ */
+static bool data_block_read_task_init(FileData *fd,
+                                      BHead *bh,
+                                      const char *blockname,
+                                      const int id_type_index,
+                                      DataBlockReadTask &r_task)
+{
+  r_task = {};
+  r_task.bhead = bh;
+  r_task.bhead_data = bh;
+
+  /* Endian switching, empty or removed blocks are handled by the regular code-path. */
+  if (bh->len == 0 || (fd->flags & FD_FLAGS_SWITCH_ENDIAN) ||
+      fd->compflags[bh->SDNAnr] == SDNA_CMP_REMOVED)
+  {
+    r_task.data = read_struct(fd, bh, blockname, id_type_index);
+    return false;
+  }
+
+  r_task.needs_reconstruct = fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL;
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
+    if (!r_task.needs_reconstruct) {
+      /* Data is read from the file directly into its final memory, nothing left to do. */
+      r_task.data = read_struct(fd, bh, blockname, id_type_index);
+      return false;
+    }
+    if (const void *data_in_place = blo_bhead_data_in_place(fd, bh)) {
+      r_task.data_src = data_in_place;
+    }
+    else {
+      r_task.bhead_data = blo_bhead_read_full(fd, bh);
+      if (UNLIKELY(r_task.bhead_data == nullptr)) {
+        fd->flags &= ~FD_FLAGS_FILE_OK;
+        return false;
+      }
+    }
+  }
+#endif
+  if (r_task.data_src == nullptr) {
+    r_task.data_src = r_task.bhead_data + 1;
+  }
+  r_task.alloc_name = get_alloc_name(fd, bh, blockname, id_type_index);
+  return true;
+}
+
+static void data_block_read_task_exec(const FileData *fd, DataBlockReadTask &task)
+{
+  const BHead *bh = task.bhead;
+  if (task.needs_reconstruct) {
+    task.data = DNA_struct_reconstruct(
+        fd->reconstruct_info, bh->SDNAnr, bh->nr, task.data_src, task.alloc_name);
+  }
+  else {
+    const int alignment = DNA_struct_alignment(fd->filesdna, bh->SDNAnr);
+    task.data = MEM_mallocN_aligned(bh->len, alignment, task.alloc_name);
+    memcpy(task.data, task.data_src, bh->len);
+  }
+}
+
+static void data_block_read_task_finish(FileData *fd, DataBlockReadTask &task)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (task.bhead_data != nullptr && task.bhead_data != task.bhead) {
+    MEM_freeN(BHEADN_FROM_BHEAD(task.bhead_data));
+  }
+#endif
+  if (task.data) {
+    const bool is_new = oldnewmap_insert(fd->datamap, task.bhead->old, task.data, 0);
+    if (!is_new) {
+      CLOG_ERROR(&LOG,
+                 "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
+                 "value (%p) for a given ID.",
+                 task.bhead->old);
+    }
+  }
+}
+
+/**
+ * Read all data associated with a datablock into datamap.
+ *
+ * Large data-blocks (typically geometry) can have many big data blocks, the DNA conversion and
+ * copying of those is done in parallel. Everything touching the file or the #FileData state
+ * (reading on demand, allocation names, datamap insertion) remains single-threaded, and the
+ * datamap is filled in file order, so the result is identical to reading serially.
+ */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
                                      const char *allocname,
                                      const int id_type_index)
 {
-  bhead = blo_bhead_next(fd, bhead);
+  using namespace blender;
+
+  Vector<DataBlockReadTask, 16> tasks;
+  Vector<int64_t, 16> parallel_tasks;
+  int64_t parallel_size = 0;
 
+  bhead = blo_bhead_next(fd, bhead);
   while (bhead && bhead->code == BLO_CODE_DATA) {
-    void *data = read_struct(fd, bhead, allocname, id_type_index);
-    if (data) {
-      const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
-      if (!is_new) {
-        CLOG_ERROR(&LOG,
-                   "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
-                   "value (%p) for a given ID.",
-                   bhead->old);
-      }
+    DataBlockReadTask task;
+    if (data_block_read_task_init(fd, bhead, allocname, id_type_index, task)) {
+      parallel_tasks.append(tasks.size());
+      parallel_size += bhead->len;
     }
-
+    tasks.append(task);
     bhead = blo_bhead_next(fd, bhead);
   }
 
+  /* Roughly the amount of bytes below which the threading overhead is not worth it. */
+  const int64_t grain_size = 256 * 1024;
+  threading::parallel_for(
+      parallel_tasks.index_range(),
+      grain_size,
+      [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          data_block_read_task_exec(fd, tasks[parallel_tasks[i]]);
+        }
+      },
+      threading::individual_task_sizes(
+          [&](const int64_t i) { return int64_t(tasks[parallel_tasks[i]].bhead->len); },
+          parallel_size));
+
+  if (!parallel_tasks.is_empty() && UNLIKELY(BLI_filereader_memory_any_io_error(fd->file))) {
+    /* Some of the data was accessed in-place in a memory-mapped file which could not be read. */
+    fd->flags &= ~FD_FLAGS_FILE_OK;
+    for (const int64_t i : parallel_tasks) {
+      MEM_SAFE_FREE(tasks[i].data);
+    }
+  }
+
+  for (DataBlockReadTask &task : tasks) {
+    data_block_read_task_finish(fd, task);
+  }
+
   return bhead;
 }
 
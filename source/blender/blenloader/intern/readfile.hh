@@ -204,6 +204,11 @@ BHead *blo_bhead_first(FileData *fd) ATTR_NONNULL(1);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock) ATTR_NONNULL(1);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock) ATTR_NONNULL(1, 2);
 
+/**
+ * Whether the given bhead is the one of an ID, of a type known by this version of Blender.
+ */
+bool blo_bhead_is_id_valid_type(const BHead *bhead);
+
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  *
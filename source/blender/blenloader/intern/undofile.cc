@@ -23,6 +23,8 @@
 #include "DNA_listBase.h"
 
 #include "BLI_implicit_sharing.hh"
+#include "BLI_map.hh"
+#include "BLI_mutex.hh"
 
 #include "BLO_readfile.hh"
 #include "BLO_undofile.hh"
@@ -31,18 +33,106 @@
 #include "BKE_main.hh"
 #include "BKE_undo_system.hh"
 
+#include <xxhash.h>
+
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
 
 /* **************** support for memory-write, for undo buffers *************** */
 
+/**
+ * Memory of a #MemFileChunk, shared by all the chunks with the same content in the whole undo
+ * stack. Changes are often reverted or repeated (e.g. toggling a setting, or sculpting on the
+ * same areas), comparing with the previous step only would store a new copy of such data.
+ */
+class MemFileChunkBuffer : public blender::ImplicitSharingInfo {
+ public:
+  struct Key {
+    XXH128_hash_t content_hash;
+    size_t size;
+
+    uint64_t hash() const
+    {
+      return content_hash.low64;
+    }
+
+    friend bool operator==(const Key &a, const Key &b)
+    {
+      return XXH128_isEqual(a.content_hash, b.content_hash) && a.size == b.size;
+    }
+  };
+
+  Key key;
+  char *data;
+  /** False when the content hash collided with another buffer, which then stays in the map. */
+  bool is_in_map;
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("MemFileChunkBuffer")
+
+ private:
+  void delete_self_with_data() override;
+};
+
+/** All the chunk buffers of the undo stack, indexed by their content. */
+static blender::Map<MemFileChunkBuffer::Key, MemFileChunkBuffer *> memfile_chunk_buffers;
+/**
+ * Protects the map, and also the removal of users of the buffers in it. Otherwise a buffer could
+ * lose its last user after it has been found in the map, but before a new user is added.
+ */
+static blender::Mutex memfile_chunk_buffers_mutex;
+
+void MemFileChunkBuffer::delete_self_with_data()
+{
+  /* Only called while #memfile_chunk_buffers_mutex is locked, see #BLO_memfile_free. */
+  if (this->is_in_map) {
+    memfile_chunk_buffers.remove(this->key);
+  }
+  MEM_freeN(this->data);
+  MEM_delete(this);
+}
+
+/**
+ * \return The buffer storing the given data, and whether it is new (not used by any other chunk).
+ */
+static MemFileChunkBuffer *memfile_chunk_buffer_ensure(const char *buf,
+                                                      const size_t size,
+                                                      bool &r_is_new)
+{
+  const MemFileChunkBuffer::Key key{XXH3_128bits(buf, size), size};
+
+  std::scoped_lock lock(memfile_chunk_buffers_mutex);
+  MemFileChunkBuffer *&existing_buffer = memfile_chunk_buffers.lookup_or_add(key, nullptr);
+  if (existing_buffer) {
+    /* Buffers are removed from the map under the same lock when their last user is removed. */
+    BLI_assert(!existing_buffer->is_expired());
+    /* Don't rely on the hash alone, a collision must not restore wrong data on undo. */
+    if (memcmp(existing_buffer->data, buf, size) == 0) {
+      existing_buffer->add_user();
+      r_is_new = false;
+      return existing_buffer;
+    }
+  }
+
+  MemFileChunkBuffer *chunk_buffer = MEM_new<MemFileChunkBuffer>(__func__);
+  chunk_buffer->key = key;
+  chunk_buffer->data = MEM_malloc_arrayN<char>(size, "Chunk buffer");
+  memcpy(chunk_buffer->data, buf, size);
+  chunk_buffer->is_in_map = existing_buffer == nullptr;
+  if (chunk_buffer->is_in_map) {
+    existing_buffer = chunk_buffer;
+  }
+  r_is_new = true;
+  return chunk_buffer;
+}
+
 void BLO_memfile_free(MemFile *memfile)
 {
-  while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
-      MEM_freeN(chunk->buf);
+  {
+    std::scoped_lock lock(memfile_chunk_buffers_mutex);
+    LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+      chunk->buf_sharing_info->remove_user_and_delete_if_last();
     }
-    MEM_freeN(chunk);
   }
+  BLI_freelistN(&memfile->chunks);
   MEM_delete(memfile->shared_storage);
   memfile->shared_storage = nullptr;
   memfile->size = 0;
@@ -56,37 +146,6 @@ MemFileSharedStorage::~MemFileSharedStorage()
   }
 }
 
-void BLO_memfile_merge(MemFile *first, MemFile *second)
-{
-  /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
-   * by it (i.e. shared with some previous memory steps). */
-  blender::Map<const char *, MemFileChunk *> buffer_to_second_memchunk;
-
-  /* First, detect all memchunks in second memfile that are not owned by it. */
-  LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
-    if (sc->is_identical) {
-      buffer_to_second_memchunk.add(sc->buf, sc);
-    }
-  }
-
-  /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
-   * it is also used by the second memfile, transfer the ownership. */
-  LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
-    if (!fc->is_identical) {
-      if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
-        BLI_assert(sc->is_identical);
-        sc->is_identical = false;
-        fc->is_identical = true;
-      }
-      /* Note that if the second memfile does not use that chunk, we assume that the first one
-       * fully owns it without sharing it with any other memfile, and hence it should be freed with
-       * it. */
-    }
-  }
-
-  BLO_memfile_free(first);
-}
-
 void BLO_memfile_clear_future(MemFile *memfile)
 {
   LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
@@ -133,6 +192,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   MemFileChunk *curchunk = MEM_mallocN<MemFileChunk>("MemFileChunk");
   curchunk->size = size;
   curchunk->buf = nullptr;
+  curchunk->buf_sharing_info = nullptr;
   curchunk->is_identical = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
@@ -147,6 +207,8 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     if (compchunk->size == curchunk->size) {
       if (memcmp(compchunk->buf, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
+        curchunk->buf_sharing_info = compchunk->buf_sharing_info;
+        curchunk->buf_sharing_info->add_user();
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
       }
@@ -154,12 +216,15 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
-  /* not equal... */
+  /* Not equal to the previous step, but the same data may still be stored by another one. */
   if (curchunk->buf == nullptr) {
-    char *buf_new = MEM_malloc_arrayN<char>(size, "Chunk buffer");
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+    bool is_new;
+    MemFileChunkBuffer *chunk_buffer = memfile_chunk_buffer_ensure(buf, size, is_new);
+    curchunk->buf = chunk_buffer->data;
+    curchunk->buf_sharing_info = chunk_buffer;
+    if (is_new) {
+      memfile->size += size;
+    }
   }
 }
 
@@ -1182,16 +1182,14 @@ static void enable_geometry_nodes_is_modifier(Main &bmain)
 void blo_do_versions_400(FileData *fd, Library * /*lib*/, Main *bmain)
 {
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 1)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      version_mesh_legacy_to_struct_of_array_format(*mesh);
-    }
+    version_parallel_for_each_id<Mesh>(
+        bmain->meshes, [](Mesh &mesh) { version_mesh_legacy_to_struct_of_array_format(mesh); });
     version_movieclips_legacy_camera_object(bmain);
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 2)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      BKE_mesh_legacy_bevel_weight_to_generic(mesh);
-    }
+    version_parallel_for_each_id<Mesh>(
+        bmain->meshes, [](Mesh &mesh) { BKE_mesh_legacy_bevel_weight_to_generic(&mesh); });
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 5)) {
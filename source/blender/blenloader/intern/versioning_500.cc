@@ -344,11 +344,11 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
 {
   using namespace blender;
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 1)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      bke::mesh_sculpt_mask_to_generic(*mesh);
-      bke::mesh_custom_normals_to_generic(*mesh);
-      rename_mesh_uv_seam_attribute(*mesh);
-    }
+    version_parallel_for_each_id<Mesh>(bmain->meshes, [](Mesh &mesh) {
+      bke::mesh_sculpt_mask_to_generic(mesh);
+      bke::mesh_custom_normals_to_generic(mesh);
+      rename_mesh_uv_seam_attribute(mesh);
+    });
 
     /* Change default Sky Texture to Nishita (after removal of old sky models) */
     FOREACH_NODETREE_BEGIN (bmain, ntree, id) {
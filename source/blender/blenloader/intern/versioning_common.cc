@@ -18,6 +18,8 @@
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_animsys.h"
 #include "BKE_grease_pencil_legacy_convert.hh"
@@ -648,6 +650,19 @@ bool all_scenes_use(Main *bmain, const blender::Span<const char *> engines)
   return true;
 }
 
+void version_parallel_for_each_id(ListBase &lb, FunctionRef<void(ID &id)> fn)
+{
+  blender::Vector<ID *> ids;
+  LISTBASE_FOREACH (ID *, id, &lb) {
+    ids.append(id);
+  }
+  blender::threading::parallel_for(ids.index_range(), 1, [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      fn(*ids[i]);
+    }
+  });
+}
+
 static bool blendfile_or_libraries_versions_atleast(Main *bmain,
                                                     const short versionfile,
                                                     const short subversionfile)
@@ -205,6 +205,18 @@ void version_forward_compat_system_idprops(Main *bmain);
 
 bool all_scenes_use(Main *bmain, const blender::Span<const char *> engines);
 
+/**
+ * Run a versioning step on all IDs of the given list-base, in parallel.
+ *
+ * Only use it for steps that are independent for each ID: they may only modify the data owned by
+ * the given ID, and must not access other IDs, add or remove IDs, or modify #Main.
+ */
+void version_parallel_for_each_id(ListBase &lb, FunctionRef<void(ID &id)> fn);
+template<typename T> void version_parallel_for_each_id(ListBase &lb, FunctionRef<void(T &id)> fn)
+{
+  version_parallel_for_each_id(lb, [&](ID &id) { fn(reinterpret_cast<T &>(id)); });
+}
+
 /**
  * Adjust the values of the given FCurve key frames by applying the given function. The function is
  * expected to get and return a float representing the value of the key frame. The FCurve is
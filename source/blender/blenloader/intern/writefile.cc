@@ -97,10 +97,17 @@
 #include "BLI_implicit_sharing.hh"
 #include "BLI_math_base.h"
 #include "BLI_multi_value_map.hh"
+#include "BLI_array.hh"
+#include "BLI_map.hh"
+#include "BLI_mutex.hh"
 #include "BLI_path_utils.hh"
+#include "BLI_profile.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_struct_equality_utils.hh"
+#include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -133,6 +140,7 @@
 
 #include "readfile.hh"
 
+#include <xxhash.h>
 #include <zstd.h>
 
 /* Make preferences read-only. */
@@ -151,8 +159,14 @@
 #define MEM_BUFFER_SIZE MEM_SIZE_OPTIMAL(1 << 17) /* 128kb */
 #define MEM_CHUNK_SIZE MEM_SIZE_OPTIMAL(1 << 15)  /* ~32kb */
 
-#define ZSTD_BUFFER_SIZE (1 << 21) /* 2mb */
-#define ZSTD_CHUNK_SIZE (1 << 20)  /* 1mb */
+#define ZSTD_CHUNK_SIZE (1 << 20) /* 1mb */
+/* Bounds for #BlendFileWriteParams.write_chunk_size. */
+#define ZSTD_CHUNK_SIZE_MIN (1 << 16) /* 64kb */
+#define ZSTD_CHUNK_SIZE_MAX (1 << 28) /* 256mb */
+/* Smallest chunk the data of consecutive IDs is combined into for #WriteWrap::use_id_chunks. */
+#define ZSTD_ID_CHUNK_SIZE_MIN (1 << 16) /* 64kb */
+/* Compressed data kept by #BlendFileWriteParams.use_compression_cache at most. */
+#define ZSTD_FRAME_CACHE_SIZE_MAX (size_t(1) << 28) /* 256mb */
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
@@ -180,6 +194,17 @@ class WriteWrap {
 
   /** Buffer output (we only want when output isn't already buffered). */
   bool use_buf = true;
+  /**
+   * Flush the buffered output at the end of an ID once at least #ZSTD_ID_CHUNK_SIZE_MIN is
+   * buffered, so that unchanged IDs are written as identical chunks in consecutive saves. Small
+   * IDs are combined, to avoid many tiny frames that compress worse.
+   */
+  bool use_id_chunks = false;
+  /**
+   * Size of the chunks the buffered output is written in, when compressing each chunk is a
+   * separately compressed frame.
+   */
+  size_t chunk_size = ZSTD_CHUNK_SIZE;
 };
 
 class RawWriteWrap : public WriteWrap {
@@ -214,22 +239,106 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/**
+ * Compressed frames of a previous save, indexed by the content of their uncompressed data.
+ */
+struct ZstdFrameCache {
+  struct Key {
+    XXH128_hash_t content_hash;
+    size_t size;
+
+    uint64_t hash() const
+    {
+      return content_hash.low64;
+    }
+
+    friend bool operator==(const Key &a, const Key &b)
+    {
+      return XXH128_isEqual(a.content_hash, b.content_hash) && a.size == b.size;
+    }
+  };
+
+  blender::Map<Key, blender::Vector<char, 0>> frames;
+  /** Total size of the compressed #frames, at most #ZSTD_FRAME_CACHE_SIZE_MAX. */
+  size_t size_in_bytes = 0;
+
+  static Key key_for_data(const void *data, const size_t size)
+  {
+    return {XXH3_128bits(data, size), size};
+  }
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("ZstdFrameCache")
+};
+
+/**
+ * Cache of the last save done with #BlendFileWriteParams.use_compression_cache. It is owned by
+ * the #ZstdWriteWrap while writing, and replaced by the frames of the new file once done.
+ */
+static ZstdFrameCache *zstd_frame_cache = nullptr;
+static blender::Mutex zstd_frame_cache_mutex;
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
+  int compression_level;
 
+  /** Frames of the previous save (read-only while writing), and of the file being written. */
+  ZstdFrameCache *frame_cache_prev = nullptr;
+  ZstdFrameCache *frame_cache_new = nullptr;
+
+  /** Threads compressing the written chunks, in any order. */
   ListBase threadpool = {};
   ListBase tasks = {};
+  /** Single thread writing the compressed frames to #base_wrap, in order. */
+  ListBase writer_thread = {};
   ThreadMutex mutex = {};
   ThreadCondition condition = {};
-  int next_frame = 0;
+
+  struct CompressedFrame {
+    /** Owned compressed data, null when reusing a frame from #frame_cache_prev. */
+    void *buf;
+    const void *data;
+    /** Compressed size, or a zstd error code. */
+    size_t size;
+    size_t uncompressed_size;
+    std::optional<ZstdFrameCache::Key> cache_key;
+  };
+  /** Compressed frames waiting to be written, indexed by their frame number. */
+  blender::Map<int, CompressedFrame> frames_compressed;
+  /**
+   * Maximum number of frames that are compressed or waiting to be written at the same time, so
+   * that serializing the file blocks instead of using more memory when the disk is slower than
+   * the compression.
+   */
+  int max_frames_in_flight = 0;
   int num_frames = 0;
+  int num_frames_written = 0;
+  /** All frames have been compressed, the writer thread can exit once they are written. */
+  bool all_frames_compressed = false;
 
   ListBase frames = {};
 
   bool write_error = false;
 
  public:
-  ZstdWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+  ZstdWriteWrap(WriteWrap &base_wrap,
+                const bool use_frame_cache = false,
+                const int compression_level = 0)
+      : base_wrap(base_wrap),
+        compression_level(compression_level ?
+                              std::clamp(compression_level, ZSTD_minCLevel(), ZSTD_maxCLevel()) :
+                              ZSTD_COMPRESSION_LEVEL)
+  {
+    if (use_frame_cache) {
+      this->use_id_chunks = true;
+      this->frame_cache_new = MEM_new<ZstdFrameCache>(__func__);
+    }
+  }
+  ~ZstdWriteWrap()
+  {
+    /* Only set when the file was not closed. */
+    MEM_delete(frame_cache_prev);
+    MEM_delete(frame_cache_new);
+  }
 
   bool open(const char *filepath) override;
   bool close() override;
@@ -237,9 +346,16 @@ class ZstdWriteWrap : public WriteWrap {
 
  private:
   struct ZstdWriteBlockTask;
-  void write_task(ZstdWriteBlockTask *task);
+  void compress_task(ZstdWriteBlockTask *task);
+  void write_frames();
   void write_u32_le(uint32_t val);
   void write_seekable_frames();
+
+  static void *writer_thread_run(void *userdata)
+  {
+    static_cast<ZstdWriteWrap *>(userdata)->write_frames();
+    return nullptr;
+  }
 };
 
 struct ZstdWriteWrap::ZstdWriteBlockTask {
@@ -249,50 +365,98 @@ struct ZstdWriteWrap::ZstdWriteBlockTask {
   int frame_number;
   ZstdWriteWrap *ww;
 
-  static void *write_task(void *userdata)
+  static void *compress_task(void *userdata)
   {
     auto *task = static_cast<ZstdWriteBlockTask *>(userdata);
-    task->ww->write_task(task);
+    task->ww->compress_task(task);
     return nullptr;
   }
 };
 
-void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
+void ZstdWriteWrap::compress_task(ZstdWriteBlockTask *task)
 {
-  size_t out_buf_len = ZSTD_compressBound(task->size);
-  void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  CompressedFrame frame{};
+  frame.uncompressed_size = task->size;
+
+  const blender::Vector<char, 0> *cached_frame = nullptr;
+  if (frame_cache_new) {
+    frame.cache_key = ZstdFrameCache::key_for_data(task->data, task->size);
+    if (frame_cache_prev) {
+      cached_frame = frame_cache_prev->frames.lookup_ptr(*frame.cache_key);
+    }
+  }
+
+  if (cached_frame) {
+    /* Same content as in the previous save, no need to compress it again. */
+    frame.data = cached_frame->data();
+    frame.size = cached_frame->size();
+  }
+  else {
+    size_t out_buf_len = ZSTD_compressBound(task->size);
+    frame.buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
+    frame.data = frame.buf;
+    frame.size = ZSTD_compress(
+        frame.buf, out_buf_len, task->data, task->size, this->compression_level);
+  }
 
   MEM_freeN(task->data);
 
   BLI_mutex_lock(&mutex);
+  frames_compressed.add_new(task->frame_number, std::move(frame));
+  BLI_mutex_unlock(&mutex);
+  BLI_condition_notify_all(&condition);
+}
 
-  while (next_frame != task->frame_number) {
-    BLI_condition_wait(&condition, &mutex);
-  }
+void ZstdWriteWrap::write_frames()
+{
+  BLI_mutex_lock(&mutex);
+  while (true) {
+    std::optional<CompressedFrame> frame = frames_compressed.pop_try(num_frames_written);
+    if (!frame) {
+      if (all_frames_compressed && frames_compressed.is_empty()) {
+        break;
+      }
+      BLI_condition_wait(&condition, &mutex);
+      continue;
+    }
+    bool success = !write_error;
+    BLI_mutex_unlock(&mutex);
 
-  if (ZSTD_isError(out_size)) {
-    write_error = true;
-  }
-  else {
-    if (base_wrap.write(out_buf, out_size)) {
+    /* Write without holding the lock, so that compression continues meanwhile. */
+    if (ZSTD_isError(frame->size)) {
+      success = false;
+    }
+    else if (success) {
+      success = base_wrap.write(frame->data, frame->size);
+    }
+    if (success) {
       ZstdFrame *frameinfo = MEM_mallocN<ZstdFrame>("zstd frameinfo");
-      frameinfo->uncompressed_size = task->size;
-      frameinfo->compressed_size = out_size;
+      frameinfo->uncompressed_size = frame->uncompressed_size;
+      frameinfo->compressed_size = frame->size;
       BLI_addtail(&frames, frameinfo);
+
+      /* Only accessed from this thread while writing. Once the cache is full, the remaining
+       * frames are compressed again by the next save. */
+      if (frame->cache_key &&
+          frame_cache_new->size_in_bytes + frame->size <= ZSTD_FRAME_CACHE_SIZE_MAX)
+      {
+        frame_cache_new->frames.lookup_or_add_cb(*frame->cache_key, [&]() {
+          frame_cache_new->size_in_bytes += frame->size;
+          const char *out_chars = static_cast<const char *>(frame->data);
+          return blender::Vector<char, 0>(blender::Span<char>(out_chars, frame->size));
+        });
+      }
     }
-    else {
+    MEM_SAFE_FREE(frame->buf);
+
+    BLI_mutex_lock(&mutex);
+    if (!success) {
       write_error = true;
     }
+    num_frames_written++;
+    BLI_condition_notify_all(&condition);
   }
-
-  next_frame++;
-
   BLI_mutex_unlock(&mutex);
-  BLI_condition_notify_all(&condition);
-
-  MEM_freeN(out_buf);
 }
 
 bool ZstdWriteWrap::open(const char *filepath)
@@ -301,12 +465,24 @@ bool ZstdWriteWrap::open(const char *filepath)
     return false;
   }
 
+  if (frame_cache_new) {
+    std::scoped_lock lock(zstd_frame_cache_mutex);
+    /* Only one file can reuse the cache at a time, concurrent writes just don't use it. */
+    frame_cache_prev = zstd_frame_cache;
+    zstd_frame_cache = nullptr;
+  }
+
   /* Leave one thread open for the main writing logic, unless we only have one HW thread. */
   int num_threads = max_ii(1, BLI_system_thread_count() - 1);
-  BLI_threadpool_init(&threadpool, ZstdWriteBlockTask::write_task, num_threads);
+  BLI_threadpool_init(&threadpool, ZstdWriteBlockTask::compress_task, num_threads);
   BLI_mutex_init(&mutex);
   BLI_condition_init(&condition);
 
+  /* Enough to keep all compression threads busy while the previous frames are written. */
+  max_frames_in_flight = num_threads * 2;
+  BLI_threadpool_init(&writer_thread, writer_thread_run, 1);
+  BLI_threadpool_insert(&writer_thread, this);
+
   return true;
 }
 
@@ -356,18 +532,45 @@ bool ZstdWriteWrap::close()
   BLI_threadpool_end(&threadpool);
   BLI_freelistN(&tasks);
 
+  BLI_mutex_lock(&mutex);
+  all_frames_compressed = true;
+  BLI_mutex_unlock(&mutex);
+  BLI_condition_notify_all(&condition);
+  BLI_threadpool_end(&writer_thread);
+  BLI_assert(frames_compressed.is_empty());
+
   BLI_mutex_end(&mutex);
   BLI_condition_end(&condition);
 
   write_seekable_frames();
   BLI_freelistN(&frames);
 
+  if (frame_cache_new) {
+    /* Keep the frames of the last successfully written file only, so that the cache does not
+     * grow beyond the size of a single compressed file. */
+    ZstdFrameCache *frame_cache_keep = write_error ? frame_cache_prev : frame_cache_new;
+    MEM_delete(write_error ? frame_cache_new : frame_cache_prev);
+    frame_cache_prev = nullptr;
+    frame_cache_new = nullptr;
+
+    std::scoped_lock lock(zstd_frame_cache_mutex);
+    MEM_delete(zstd_frame_cache);
+    zstd_frame_cache = frame_cache_keep;
+  }
+
   return base_wrap.close() && !write_error;
 }
 
 bool ZstdWriteWrap::write(const void *buf, const size_t buf_len)
 {
-  if (write_error) {
+  BLI_mutex_lock(&mutex);
+  /* Wait for the writer thread to catch up. */
+  while (!write_error && num_frames - num_frames_written >= max_frames_in_flight) {
+    BLI_condition_wait(&condition, &mutex);
+  }
+  const bool has_error = write_error;
+  BLI_mutex_unlock(&mutex);
+  if (has_error) {
     return false;
   }
 
@@ -378,15 +581,12 @@ bool ZstdWriteWrap::write(const void *buf, const size_t buf_len)
   task->frame_number = num_frames++;
   task->ww = this;
 
-  BLI_mutex_lock(&mutex);
   BLI_addtail(&tasks, task);
 
   /* If there's a free worker thread, just push the block into that thread.
-   * Otherwise, we wait for the earliest thread to finish.
-   * We look up the earliest thread while holding the mutex, but release it
-   * before joining the thread to prevent a deadlock. */
+   * Otherwise, we wait for the earliest thread to finish. The worker threads only compress, so
+   * this does not wait for any file writing. */
   ZstdWriteBlockTask *first_task = static_cast<ZstdWriteBlockTask *>(tasks.first);
-  BLI_mutex_unlock(&mutex);
   if (!BLI_available_threads(&threadpool)) {
     BLI_threadpool_remove(&threadpool, first_task);
 
@@ -401,6 +601,28 @@ bool ZstdWriteWrap::write(const void *buf, const size_t buf_len)
   return true;
 }
 
+/**
+ * Keeps all written data in memory, to write it to a file later on.
+ */
+class MemoryWriteWrap : public WriteWrap {
+ public:
+  blender::Vector<blender::Array<char, 0>> chunks;
+
+  bool open(const char * /*filepath*/) override
+  {
+    return true;
+  }
+  bool close() override
+  {
+    return true;
+  }
+  bool write(const void *buf, const size_t buf_len) override
+  {
+    chunks.append(blender::Span<char>(static_cast<const char *>(buf), int64_t(buf_len)));
+    return true;
+  }
+};
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -482,8 +704,8 @@ static WriteData *writedata_new(WriteWrap *ww)
       wd->buffer.chunk_size = MEM_CHUNK_SIZE;
     }
     else {
-      wd->buffer.max_size = ZSTD_BUFFER_SIZE;
-      wd->buffer.chunk_size = ZSTD_CHUNK_SIZE;
+      wd->buffer.max_size = ww->chunk_size * 2;
+      wd->buffer.chunk_size = ww->chunk_size;
     }
     wd->buffer.buf = MEM_malloc_arrayN<uchar>(wd->buffer.max_size, "wd->buffer.buf");
   }
@@ -689,6 +911,10 @@ static void mywrite_id_end(WriteData *wd, ID * /*id*/)
     mywrite_flush(wd);
     wd->mem.current_id_session_uid = MAIN_ID_SESSION_UID_UNSET;
   }
+  else if (wd->ww && wd->ww->use_id_chunks && wd->buffer.used_len >= ZSTD_ID_CHUNK_SIZE_MIN) {
+    /* Start the data of the next ID in a new chunk, see #WriteWrap::use_id_chunks. */
+    mywrite_flush(wd);
+  }
 
   wd->validation_data.per_id_addresses_set.clear();
   wd->per_id_written_shared_addresses.clear();
@@ -1850,6 +2076,158 @@ static bool BLO_write_file_impl(Main *mainvar,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Background File Writing
+ *
+ * See #BlendFileWriteParams.use_background_write.
+ * \{ */
+
+static size_t write_chunk_size_from_params(const BlendFileWriteParams &params)
+{
+  if (params.write_chunk_size == 0) {
+    return ZSTD_CHUNK_SIZE;
+  }
+  return std::clamp<size_t>(params.write_chunk_size, ZSTD_CHUNK_SIZE_MIN, ZSTD_CHUNK_SIZE_MAX);
+}
+
+struct BackgroundWriteTask {
+  std::string filepath;
+  int write_flags;
+  bool use_compression_cache;
+  int compression_level;
+  size_t chunk_size;
+  blender::Vector<blender::Array<char, 0>> chunks;
+};
+
+/** Only accessed from the main thread, tasks are executed one after the other. */
+static TaskPool *background_write_pool = nullptr;
+
+static bool write_file_chunks(WriteWrap &ww,
+                              const char *filepath,
+                              const blender::Span<blender::Array<char, 0>> chunks)
+{
+  if (ww.open(filepath) == false) {
+    CLOG_ERROR(&LOG, "Cannot open file %s for writing: %s", filepath, strerror(errno));
+    return false;
+  }
+  bool success = true;
+  for (const blender::Array<char, 0> &chunk : chunks) {
+    if (!ww.write(chunk.data(), chunk.size())) {
+      success = false;
+      break;
+    }
+  }
+  /* Always close, the compression threads have to finish. */
+  success = ww.close() && success;
+  if (!success) {
+    CLOG_ERROR(&LOG, "Cannot write file %s: %s", filepath, strerror(errno));
+  }
+  return success;
+}
+
+static void write_file_background_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  BackgroundWriteTask *task = static_cast<BackgroundWriteTask *>(taskdata);
+
+  char tempname[FILE_MAX + 1];
+  SNPRINTF(tempname, "%s@", task->filepath.c_str());
+
+  RawWriteWrap raw_wrap;
+  raw_wrap.chunk_size = task->chunk_size;
+  bool success;
+  if (task->write_flags & G_FILE_COMPRESS) {
+    ZstdWriteWrap zstd_wrap(raw_wrap, task->use_compression_cache, task->compression_level);
+    zstd_wrap.chunk_size = task->chunk_size;
+    success = write_file_chunks(zstd_wrap, tempname, task->chunks);
+  }
+  else {
+    success = write_file_chunks(raw_wrap, tempname, task->chunks);
+  }
+  /* Free the uncompressed data as soon as possible. */
+  task->chunks.clear_and_shrink();
+
+  if (!success) {
+    remove(tempname);
+    return;
+  }
+  if (BLI_rename_overwrite(tempname, task->filepath.c_str()) != 0) {
+    CLOG_ERROR(&LOG, "Cannot change old file %s (file saved with @)", task->filepath.c_str());
+  }
+}
+
+static void write_file_background_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<BackgroundWriteTask *>(taskdata));
+}
+
+static bool write_file_background(Main *mainvar,
+                                  const char *filepath,
+                                  const int write_flags,
+                                  const BlendFileWriteParams *params,
+                                  ReportList *reports)
+{
+  BLI_assert(BLI_thread_is_main());
+  BLI_assert(params->remap_mode == BLO_WRITE_PATH_REMAP_NONE && !params->use_save_versions);
+
+  if ((write_flags & G_FILE_ASSET_EDIT_FILE) && !mainvar->is_asset_edit_file) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot save normal file (%s) as asset system file", filepath);
+    return false;
+  }
+
+  write_file_main_validate_pre(mainvar, reports);
+
+  MemoryWriteWrap mem_wrap;
+  mem_wrap.use_id_chunks = params->use_compression_cache;
+  mem_wrap.chunk_size = write_chunk_size_from_params(*params);
+  const bool err = write_file_handle(mainvar,
+                                     &mem_wrap,
+                                     nullptr,
+                                     nullptr,
+                                     write_flags,
+                                     params->use_userdef,
+                                     params->thumb,
+                                     nullptr);
+  if (err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    return false;
+  }
+  write_file_main_validate_post(mainvar, reports);
+
+  BackgroundWriteTask *task = MEM_new<BackgroundWriteTask>(__func__);
+  task->filepath = filepath;
+  task->write_flags = write_flags;
+  task->use_compression_cache = params->use_compression_cache;
+  task->compression_level = params->compression_level;
+  task->chunk_size = mem_wrap.chunk_size;
+  task->chunks = std::move(mem_wrap.chunks);
+
+  if (background_write_pool == nullptr) {
+    background_write_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  BLI_task_pool_push(background_write_pool,
+                     write_file_background_run,
+                     task,
+                     false,
+                     write_file_background_task_free);
+
+  if (mainvar->is_global_main && !params->use_save_as_copy) {
+    STRNCPY(G.filepath_last_blend, filepath);
+  }
+  return true;
+}
+
+void BLO_write_file_background_wait()
+{
+  BLI_assert(BLI_thread_is_main());
+  if (background_write_pool) {
+    BLI_task_pool_work_and_wait(background_write_pool);
+    BLI_task_pool_free(background_write_pool);
+    background_write_pool = nullptr;
+  }
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name File Writing (Public)
  * \{ */
@@ -1860,10 +2238,19 @@ bool BLO_write_file(Main *mainvar,
                     const BlendFileWriteParams *params,
                     ReportList *reports)
 {
+  BLI_PROFILE_SCOPE("Write Blend File");
+  if (params->use_background_write && params->remap_mode == BLO_WRITE_PATH_REMAP_NONE &&
+      !params->use_save_versions)
+  {
+    return write_file_background(mainvar, filepath, write_flags, params, reports);
+  }
+
   RawWriteWrap raw_wrap;
+  raw_wrap.chunk_size = write_chunk_size_from_params(*params);
 
   if (write_flags & G_FILE_COMPRESS) {
-    ZstdWriteWrap zstd_wrap(raw_wrap);
+    ZstdWriteWrap zstd_wrap(raw_wrap, params->use_compression_cache, params->compression_level);
+    zstd_wrap.chunk_size = raw_wrap.chunk_size;
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
@@ -1880,6 +2267,13 @@ bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, const
   return (err == 0);
 }
 
+void BLO_write_compression_cache_free()
+{
+  std::scoped_lock lock(zstd_frame_cache_mutex);
+  MEM_delete(zstd_frame_cache);
+  zstd_frame_cache = nullptr;
+}
+
 /*
  * API to write chunks of data.
  */
@@ -7719,11 +7719,10 @@ void BM_mesh_bevel(BMesh *bm,
                    const int bweight_offset_edge)
 {
   BMIter iter, liter;
-  BMVert *v, *v_next;
+  BMVert *v;
   BMEdge *e;
   BMFace *f;
   BMLoop *l;
-  BevVert *bv;
   BevelParams bp{};
   bp.bm = bm;
   bp.offset = offset;
@@ -7806,12 +7805,20 @@ void BM_mesh_bevel(BMesh *bm,
 
   math_layer_info_init(&bp, bm);
 
+  /* The beveled vertices in mesh order, so the passes below don't have to go over the whole mesh
+   * and look each of them up in #BevelParams.vert_hash. Vertices that aren't beveled after all
+   * have their tag cleared by #bevel_vert_construct. */
+  Vector<BevVert *> bevverts;
+
   /* Analyze input vertices, sorting edges and assigning initial new vertex positions. */
   BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
     if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      bv = bevel_vert_construct(bm, &bp, v);
-      if (!limit_offset && bv) {
-        build_boundary(&bp, bv, true);
+      BevVert *bv = bevel_vert_construct(bm, &bp, v);
+      if (bv) {
+        bevverts.append(bv);
+        if (!limit_offset) {
+          build_boundary(&bp, bv, true);
+        }
       }
     }
   }
@@ -7821,13 +7828,8 @@ void BM_mesh_bevel(BMesh *bm,
     bevel_limit_offset(&bp, bm);
 
     /* Assign initial new vertex positions. */
-    BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-      if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-        bv = find_bevvert(&bp, v);
-        if (bv) {
-          build_boundary(&bp, bv, true);
-        }
-      }
+    for (BevVert *bv : bevverts) {
+      build_boundary(&bp, bv, true);
     }
   }
 
@@ -7846,13 +7848,8 @@ void BM_mesh_bevel(BMesh *bm,
   }
 
   /* Build the meshes around vertices, now that positions are final. */
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      bv = find_bevvert(&bp, v);
-      if (bv) {
-        build_vmesh(&bp, bm, bv);
-      }
-    }
+  for (BevVert *bv : bevverts) {
+    build_vmesh(&bp, bm, bv);
   }
 
   /* Build polygons for edges. */
@@ -7865,28 +7862,19 @@ void BM_mesh_bevel(BMesh *bm,
   }
 
   /* Extend edge data like sharp edges and precompute normals for harden. */
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      bv = find_bevvert(&bp, v);
-      if (bv) {
-        bevel_extend_edge_data(bv);
-      }
-    }
+  for (BevVert *bv : bevverts) {
+    bevel_extend_edge_data(bv);
   }
 
   /* Rebuild face polygons around affected vertices. */
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      bevel_rebuild_existing_polygons(bm, &bp, v);
-      bevel_reattach_wires(bm, &bp, v);
-    }
+  for (BevVert *bv : bevverts) {
+    bevel_rebuild_existing_polygons(bm, &bp, bv->v);
+    bevel_reattach_wires(bm, &bp, bv->v);
   }
 
-  BM_ITER_MESH_MUTABLE (v, v_next, &iter, bm, BM_VERTS_OF_MESH) {
-    if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      BLI_assert(find_bevvert(&bp, v) != nullptr);
-      BM_vert_kill(bm, v);
-    }
+  for (BevVert *bv : bevverts) {
+    BLI_assert(BM_elem_flag_test(bv->v, BM_ELEM_TAG));
+    BM_vert_kill(bm, bv->v);
   }
 
   if (bp.harden_normals) {
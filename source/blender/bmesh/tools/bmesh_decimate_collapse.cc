@@ -13,6 +13,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_heap.h"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
@@ -21,6 +22,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.hh"
@@ -227,19 +229,21 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * \return false when the edge should not be collapsed.
+ */
+static bool bm_decim_edge_cost_calc(BMEdge *e,
+                                    const Quadric *vquadrics,
+                                    const float *vweights,
+                                    const float vweight_factor,
+                                    float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f))))
   {
-    goto clear;
+    return false;
   }
 
   /* Check we can collapse, some edges we better not touch. */
@@ -249,7 +253,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -258,11 +262,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* End sanity check. */
 
@@ -315,10 +319,23 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
+
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+  if (bm_decim_edge_cost_calc(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
 
-clear:
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
@@ -340,14 +357,22 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
+  /* Computing the costs is independent for every edge, only filling the heap is serial. The heap
+   * is filled in edge order, the same as building the cost of each edge in turn. */
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+  blender::Array<float> costs(bm->totedge);
+  blender::Array<bool> is_valid(bm->totedge);
+  blender::threading::parallel_for(
+      blender::IndexRange(bm->totedge), 1024, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          is_valid[i] = bm_decim_edge_cost_calc(
+              BM_edge_at_index(bm, i), vquadrics, vweights, vweight_factor, &costs[i]);
+        }
+      });
 
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = nullptr;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  for (const int i : blender::IndexRange(bm->totedge)) {
+    eheap_table[i] = is_valid[i] ? BLI_heap_insert(eheap, costs[i], BM_edge_at_index(bm, i)) :
+                                   nullptr;
   }
 }
 
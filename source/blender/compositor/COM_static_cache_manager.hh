@@ -46,7 +46,12 @@ namespace blender::compositor {
  * evaluation will be deleted before the next evaluation. This mechanism is implemented in the
  * reset() method of the class, which should be called before every evaluation. The reset for the
  * next evaluation can be skipped by calling the skip_next_reset() method, see its description for
- * more information. */
+ * more information.
+ *
+ * Only resources that are expensive to compute from a small key are cached, like images, masks,
+ * keying screens and kernels. Node outputs are not cached across evaluations, since deciding
+ * whether a whole branch is unchanged would require hashing all of its inputs, including the
+ * images and their time dependence, and keeping full-frame results alive between evaluations. */
 class StaticCacheManager {
  public:
   SymmetricBlurWeightsContainer symmetric_blur_weights;
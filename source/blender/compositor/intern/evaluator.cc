@@ -51,6 +51,10 @@ void Evaluator::evaluate()
 
   const Schedule schedule = compute_schedule(context_, *derived_node_tree_);
 
+  /* NOTE: Operations are evaluated on whole frames, there is no tiled execution. Consecutive pixel
+   * nodes are fused into a single #PixelOperation, so they don't create intermediate results, and
+   * results are released as soon as their last user was evaluated. The schedule is also ordered to
+   * keep the number of live results low (see `scheduler.cc`). */
   CompileState compile_state(context_, schedule);
 
   for (const DNode &node : schedule) {
@@ -53,6 +53,19 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Start recording the start and end time, and the thread, of every operation evaluated by the
+ * graph. Restarts the recording when it was already active.
+ */
+void DEG_debug_trace_begin(Depsgraph *graph);
+/**
+ * Stop the recording started by #DEG_debug_trace_begin, and write it to the given file (if not
+ * null) in the Chrome trace event format, which can be opened with `chrome://tracing` or Perfetto.
+ *
+ * \return False if the trace was not recording.
+ */
+bool DEG_debug_trace_end(Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -16,8 +16,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_action_types.h"
@@ -378,6 +380,7 @@ void DepsgraphNodeBuilder::begin_build()
 {
   /* Store existing evaluated versions of datablock, so we can re-use
    * them for new ID nodes. */
+  id_info_hash_.reserve(graph_->id_nodes.size());
   for (IDNode *id_node : graph_->id_nodes) {
     /* It is possible that the ID does not need to have evaluated version in which case id_cow is
      * the same as id_orig. Additionally, such ID might have been removed, which makes the check
@@ -412,9 +415,14 @@ void DepsgraphNodeBuilder::begin_build()
   }
 
   /* Make sure graph has no nodes left from previous state. */
+  const int64_t id_nodes_num = graph_->id_nodes.size();
   graph_->clear_all_nodes();
   graph_->operations.clear();
   graph_->entry_tags.clear();
+
+  /* Rebuilt graph is typically of a similar size as the previous one: avoid growing the ID hash
+   * step by step while nodes are being added. The vectors keep their capacity when cleared. */
+  graph_->id_hash.reserve(id_nodes_num);
 }
 
 /* Utility callbacks for `BKE_library_foreach_ID_link`, used to detect when an evaluated ID is
@@ -427,41 +435,31 @@ void DepsgraphNodeBuilder::begin_build()
  * NOTE: This is split in two, a static function and a public method of the node builder, to allow
  * the code to access the builder's data more easily. */
 
-int DepsgraphNodeBuilder::foreach_id_cow_detect_need_for_update_callback(ID *id_cow_self,
-                                                                         ID *id_pointer)
+bool DepsgraphNodeBuilder::id_cow_pointer_needs_update(const ID *id_pointer) const
 {
   if (id_pointer->orig_id == nullptr) {
     /* `id_cow_self` uses a non-cow ID, if that ID has an evaluated copy in current depsgraph its
      * owner needs to be remapped, i.e. copy-on-eval-flushed. */
-    IDNode *id_node = find_id_node(id_pointer);
-    if (id_node != nullptr && id_node->id_cow != nullptr) {
-      graph_id_tag_update(bmain_,
-                          graph_,
-                          id_cow_self->orig_id,
-                          ID_RECALC_SYNC_TO_EVAL,
-                          DEG_UPDATE_SOURCE_RELATIONS);
-      return IDWALK_RET_STOP_ITER;
-    }
+    const IDNode *id_node = graph_->find_id_node(id_pointer);
+    return id_node != nullptr && id_node->id_cow != nullptr;
   }
-  else {
-    /* `id_cow_self` uses an evaluated ID, if that evaluated copy is removed from current depsgraph
-     * its owner needs to be remapped, i.e. copy-on-eval-flushed. */
-    /* NOTE: at that stage, old existing evaluated copies that are to be removed from current state
-     * of evaluated depsgraph are still valid pointers, they are freed later (typically during
-     * destruction of the builder itself). */
-    IDNode *id_node = find_id_node(id_pointer->orig_id);
-    if (id_node == nullptr) {
-      graph_id_tag_update(bmain_,
-                          graph_,
-                          id_cow_self->orig_id,
-                          ID_RECALC_SYNC_TO_EVAL,
-                          DEG_UPDATE_SOURCE_RELATIONS);
-      return IDWALK_RET_STOP_ITER;
-    }
-  }
-  return IDWALK_RET_NOP;
+  /* `id_cow_self` uses an evaluated ID, if that evaluated copy is removed from current depsgraph
+   * its owner needs to be remapped, i.e. copy-on-eval-flushed. */
+  /* NOTE: at that stage, old existing evaluated copies that are to be removed from current state
+   * of evaluated depsgraph are still valid pointers, they are freed later (typically during
+   * destruction of the builder itself). */
+  return graph_->find_id_node(id_pointer->orig_id) == nullptr;
 }
 
+namespace {
+
+struct DetectNeedForUpdateData {
+  const DepsgraphNodeBuilder *builder;
+  bool needs_update;
+};
+
+}  // namespace
+
 static int foreach_id_cow_detect_need_for_update_callback(LibraryIDLinkCallbackData *cb_data)
 {
   ID *id = *cb_data->id_pointer;
@@ -474,10 +472,12 @@ static int foreach_id_cow_detect_need_for_update_callback(LibraryIDLinkCallbackD
     return IDWALK_RET_NOP;
   }
 
-  DepsgraphNodeBuilder *builder = static_cast<DepsgraphNodeBuilder *>(cb_data->user_data);
-  ID *id_cow_self = cb_data->self_id;
-
-  return builder->foreach_id_cow_detect_need_for_update_callback(id_cow_self, id);
+  DetectNeedForUpdateData *data = static_cast<DetectNeedForUpdateData *>(cb_data->user_data);
+  if (data->builder->id_cow_pointer_needs_update(id)) {
+    data->needs_update = true;
+    return IDWALK_RET_STOP_ITER;
+  }
+  return IDWALK_RET_NOP;
 }
 
 void DepsgraphNodeBuilder::update_invalid_cow_pointers()
@@ -492,44 +492,67 @@ void DepsgraphNodeBuilder::update_invalid_cow_pointers()
    * some cases. This is slightly unfortunate (as it may hide issues in other parts of Blender
    * code), but cannot really be avoided currently. */
 
-  for (const IDNode *id_node : graph_->id_nodes) {
-    if (id_node->previously_visible_components_mask == 0) {
-      /* Newly added node/ID, no need to check it. */
-      continue;
+  /* The detection only reads the graph and the evaluated IDs, so it is done in parallel for all
+   * ID nodes. Tagging is not thread-safe and is done afterwards. */
+  const Span<IDNode *> id_nodes = graph_->id_nodes;
+  Array<bool> needs_update(id_nodes.size(), false);
+  threading::parallel_for(id_nodes.index_range(), 64, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      needs_update[i] = id_cow_needs_update(*id_nodes[i]);
     }
-    if (ELEM(id_node->id_cow, id_node->id_orig, nullptr)) {
-      /* Node/ID with no copy-on-eval data, no need to check it. */
-      continue;
-    }
-    if ((id_node->id_cow->recalc & ID_RECALC_SYNC_TO_EVAL) != 0) {
-      /* Node/ID already tagged for copy-on-eval flush, no need to check it. */
-      continue;
-    }
-    if ((id_node->id_cow->flag & ID_FLAG_EMBEDDED_DATA) != 0) {
-      /* For now, we assume embedded data are managed by their owner IDs and do not need to be
-       * checked here.
-       *
-       * NOTE: This exception somewhat weak, and ideally should not be needed. Currently however,
-       * embedded data are handled as full local (private) data of their owner IDs in part of
-       * Blender (like read/write code, including undo/redo), while depsgraph generally treat them
-       * as regular independent IDs. This leads to inconsistencies that can lead to bad level
-       * memory accesses.
-       *
-       * E.g. when undoing creation/deletion of a collection directly child of a scene's master
-       * collection, the scene itself is re-read in place, but its master collection becomes a
-       * completely new different pointer, and the existing copy-on-eval of the old master
-       * collection in the matching deg node is therefore pointing to fully invalid (freed) memory.
-       */
-      continue;
+  });
+
+  for (const int64_t i : id_nodes.index_range()) {
+    if (needs_update[i]) {
+      graph_id_tag_update(bmain_,
+                          graph_,
+                          id_nodes[i]->id_orig,
+                          ID_RECALC_SYNC_TO_EVAL,
+                          DEG_UPDATE_SOURCE_RELATIONS);
     }
-    BKE_library_foreach_ID_link(nullptr,
-                                id_node->id_cow,
-                                deg::foreach_id_cow_detect_need_for_update_callback,
-                                this,
-                                IDWALK_IGNORE_EMBEDDED_ID | IDWALK_READONLY);
   }
 }
 
+bool DepsgraphNodeBuilder::id_cow_needs_update(const IDNode &id_node) const
+{
+  if (id_node.previously_visible_components_mask == 0) {
+    /* Newly added node/ID, no need to check it. */
+    return false;
+  }
+  if (ELEM(id_node.id_cow, id_node.id_orig, nullptr)) {
+    /* Node/ID with no copy-on-eval data, no need to check it. */
+    return false;
+  }
+  if ((id_node.id_cow->recalc & ID_RECALC_SYNC_TO_EVAL) != 0) {
+    /* Node/ID already tagged for copy-on-eval flush, no need to check it. */
+    return false;
+  }
+  if ((id_node.id_cow->flag & ID_FLAG_EMBEDDED_DATA) != 0) {
+    /* For now, we assume embedded data are managed by their owner IDs and do not need to be
+     * checked here.
+     *
+     * NOTE: This exception somewhat weak, and ideally should not be needed. Currently however,
+     * embedded data are handled as full local (private) data of their owner IDs in part of
+     * Blender (like read/write code, including undo/redo), while depsgraph generally treat them
+     * as regular independent IDs. This leads to inconsistencies that can lead to bad level
+     * memory accesses.
+     *
+     * E.g. when undoing creation/deletion of a collection directly child of a scene's master
+     * collection, the scene itself is re-read in place, but its master collection becomes a
+     * completely new different pointer, and the existing copy-on-eval of the old master
+     * collection in the matching deg node is therefore pointing to fully invalid (freed) memory.
+     */
+    return false;
+  }
+  DetectNeedForUpdateData data = {this, false};
+  BKE_library_foreach_ID_link(nullptr,
+                              id_node.id_cow,
+                              deg::foreach_id_cow_detect_need_for_update_callback,
+                              &data,
+                              IDWALK_IGNORE_EMBEDDED_ID | IDWALK_READONLY);
+  return data.needs_update;
+}
+
 void DepsgraphNodeBuilder::tag_previously_tagged_nodes()
 {
   for (const OperationKey &operation_key : saved_entry_tags_) {
@@ -92,10 +92,10 @@ class DepsgraphNodeBuilder : public DepsgraphBuilder {
   virtual void end_build();
 
   /**
-   * `id_cow_self` is the user of `id_pointer`,
-   * see also `LibraryIDLinkCallbackData` struct definition.
+   * Check whether an evaluated ID using `id_pointer` needs to be copy-on-eval-flushed.
+   * Only reads the graph, so it is safe to call from multiple threads.
    */
-  int foreach_id_cow_detect_need_for_update_callback(ID *id_cow_self, ID *id_pointer);
+  bool id_cow_pointer_needs_update(const ID *id_pointer) const;
 
   IDNode *add_id_node(ID *id);
   IDNode *find_id_node(const ID *id);
@@ -326,6 +326,7 @@ class DepsgraphNodeBuilder : public DepsgraphBuilder {
    * because the depsgraph itself created or removed some of their evaluated dependencies.
    */
   void update_invalid_cow_pointers();
+  bool id_cow_needs_update(const IDNode &id_node) const;
 
   /* State which demotes currently built entities. */
   Scene *scene_;
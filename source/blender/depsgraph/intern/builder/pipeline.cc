@@ -28,18 +28,32 @@ AbstractBuilderPipeline::AbstractBuilderPipeline(::Depsgraph *graph)
 
 void AbstractBuilderPipeline::build()
 {
+  const bool use_timing = G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME);
   double start_time = 0.0;
-  if (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) {
+  double nodes_time = 0.0;
+  double relations_time = 0.0;
+  if (use_timing) {
     start_time = BLI_time_now_seconds();
   }
 
   build_step_sanity_check();
   build_step_nodes();
+  if (use_timing) {
+    nodes_time = BLI_time_now_seconds();
+  }
   build_step_relations();
+  if (use_timing) {
+    relations_time = BLI_time_now_seconds();
+  }
   build_step_finalize();
 
-  if (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) {
-    printf("Depsgraph built in %f seconds.\n", BLI_time_now_seconds() - start_time);
+  if (use_timing) {
+    const double end_time = BLI_time_now_seconds();
+    printf("Depsgraph built in %f seconds (nodes: %f, relations: %f, finalize: %f).\n",
+           end_time - start_time,
+           nodes_time - start_time,
+           relations_time - nodes_time,
+           end_time - relations_time);
   }
 }
 
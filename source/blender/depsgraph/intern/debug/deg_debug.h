@@ -8,15 +8,19 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "BKE_global.hh"  // IWYU pragma: keep
 
 namespace blender::deg {
 
+class DepsgraphTrace;
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
+  ~DepsgraphDebug();
 
   bool do_time_debug() const;
 
@@ -30,6 +34,9 @@ class DepsgraphDebug {
    * created for different view layer). */
   std::string name;
 
+  /* Evaluation trace, only recorded between #DEG_debug_trace_begin and #DEG_debug_trace_end. */
+  std::unique_ptr<DepsgraphTrace> trace;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
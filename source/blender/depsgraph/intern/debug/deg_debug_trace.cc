@@ -0,0 +1,124 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_debug_trace.h"
+
+#include "BLI_time.h"
+
+#include "DEG_depsgraph_debug.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+
+DepsgraphTrace::DepsgraphTrace()
+    : thread_events_([this]() { return ThreadEvents{threads_num_.fetch_add(1), {}}; }),
+      start_time_(BLI_time_now_seconds())
+{
+}
+
+void DepsgraphTrace::add_operation(const OperationNode &operation_node,
+                                   const float frame,
+                                   const double start_time,
+                                   const double end_time)
+{
+  thread_events_.local().events.append({operation_node.full_identifier(),
+                                        nodeTypeAsString(operation_node.owner->type),
+                                        frame,
+                                        start_time,
+                                        end_time});
+}
+
+void DepsgraphTrace::add_graph_evaluation(const float frame,
+                                          const double start_time,
+                                          const double end_time)
+{
+  thread_events_.local().events.append(
+      {"Depsgraph Evaluation", "DEPSGRAPH", frame, start_time, end_time});
+}
+
+static void trace_write_json_string(FILE *fp, const StringRef str)
+{
+  fputc('"', fp);
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        fputs("\\\"", fp);
+        break;
+      case '\\':
+        fputs("\\\\", fp);
+        break;
+      default:
+        if (uchar(c) < 0x20) {
+          fprintf(fp, "\\u%04x", uint(uchar(c)));
+        }
+        else {
+          fputc(c, fp);
+        }
+        break;
+    }
+  }
+  fputc('"', fp);
+}
+
+void DepsgraphTrace::write_chrome_trace(FILE *fp)
+{
+  /* Times are in micro-seconds. */
+  auto to_trace_time = [&](const double time) { return (time - start_time_) * 1e6; };
+
+  fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  bool is_first = true;
+  for (const ThreadEvents &thread_events : thread_events_) {
+    fprintf(fp,
+            "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, "
+            "\"args\": {\"name\": \"Thread %d\"}}",
+            is_first ? "" : ",\n",
+            thread_events.thread_index,
+            thread_events.thread_index);
+    is_first = false;
+
+    for (const Event &event : thread_events.events) {
+      fprintf(fp, ",\n{\"name\": ");
+      trace_write_json_string(fp, event.name);
+      fprintf(fp,
+              ", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 0, "
+              "\"tid\": %d, \"args\": {\"frame\": %g}}",
+              event.category,
+              to_trace_time(event.start_time),
+              (event.end_time - event.start_time) * 1e6,
+              thread_events.thread_index,
+              event.frame);
+    }
+  }
+  fprintf(fp, "\n]}\n");
+}
+
+}  // namespace blender::deg
+
+void DEG_debug_trace_begin(Depsgraph *depsgraph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  deg_graph->debug.trace = std::make_unique<deg::DepsgraphTrace>();
+}
+
+bool DEG_debug_trace_end(Depsgraph *depsgraph, FILE *fp)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  std::unique_ptr<deg::DepsgraphTrace> trace = std::move(deg_graph->debug.trace);
+  if (!trace) {
+    return false;
+  }
+  if (fp) {
+    trace->write_chrome_trace(fp);
+  }
+  return true;
+}
@@ -0,0 +1,58 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_vector.hh"
+
+namespace blender::deg {
+
+struct OperationNode;
+
+/* Records the evaluation of every operation of a dependency graph, to be inspected as a timeline
+ * in a trace viewer. See #DEG_debug_trace_begin. */
+class DepsgraphTrace {
+ public:
+  DepsgraphTrace();
+
+  void add_operation(const OperationNode &operation_node,
+                     float frame,
+                     double start_time,
+                     double end_time);
+  void add_graph_evaluation(float frame, double start_time, double end_time);
+
+  /* Write all recorded events in the Chrome trace event format (also read by Perfetto). */
+  void write_chrome_trace(FILE *fp);
+
+ private:
+  struct Event {
+    std::string name;
+    const char *category;
+    float frame;
+    double start_time;
+    double end_time;
+  };
+
+  struct ThreadEvents {
+    int thread_index;
+    Vector<Event> events;
+  };
+
+  /* Events are recorded per thread, to avoid locking during evaluation. */
+  threading::EnumerableThreadSpecific<ThreadEvents> thread_events_;
+  std::atomic<int> threads_num_ = 0;
+  /* Time at which the tracing started, all events are relative to it. */
+  double start_time_;
+};
+
+}  // namespace blender::deg
@@ -9,6 +9,7 @@
  */
 
 #include "BLI_listbase.h"
+#include "BLI_profile.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_cachefile_types.h"
@@ -325,6 +326,7 @@ void DEG_graph_relations_update(Depsgraph *graph)
     /* Graph is up to date, nothing to do. */
     return;
   }
+  BLI_PROFILE_SCOPE("Depsgraph Relations Update");
   DEG_graph_build_from_view_layer(graph);
 }
 
@@ -8,15 +8,19 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstdint>
 
 #include "intern/eval/deg_eval.h"
 
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
+#include "BLI_profile.hh"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -32,6 +36,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/depsgraph_tag.hh"
@@ -82,23 +87,58 @@ struct DepsgraphEvalState {
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
+  /* Set when the evaluation time of an operation changed significantly, so that the critical path
+   * times used for scheduling are to be updated. */
+  std::atomic<bool> need_update_critical_path = false;
 };
 
-void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
+/* Evaluation times of an operation are expected to be similar across updates, but to smooth out
+ * noise only a part of the new timing is taken into account. */
+#define EVAL_TIME_ESTIMATE_FACTOR 0.25f
+/* Relative change of the estimated evaluation time of an operation above which the critical path
+ * is updated. */
+#define EVAL_TIME_ESTIMATE_CHANGE_THRESHOLD 0.5f
+/* Operations faster than this (in seconds) do not affect scheduling much, ignore their changes. */
+#define EVAL_TIME_ESTIMATE_MIN 1e-5f
+
+void update_eval_time_estimate(DepsgraphEvalState *state,
+                               OperationNode *operation_node,
+                               const float eval_time)
+{
+  const float prev_average = operation_node->eval_time_average;
+  const float average = prev_average == 0.0f ?
+                            eval_time :
+                            prev_average + (eval_time - prev_average) * EVAL_TIME_ESTIMATE_FACTOR;
+  operation_node->eval_time_average = average;
+
+  const float change = std::abs(average - operation_node->eval_time_estimate);
+  if (change > EVAL_TIME_ESTIMATE_MIN &&
+      change > operation_node->eval_time_estimate * EVAL_TIME_ESTIMATE_CHANGE_THRESHOLD)
+  {
+    operation_node->eval_time_estimate = average;
+    state->need_update_critical_path.store(true, std::memory_order_relaxed);
+  }
+}
+
+void evaluate_node(DepsgraphEvalState *state, OperationNode *operation_node)
 {
   ::Depsgraph *depsgraph = reinterpret_cast<::Depsgraph *>(state->graph);
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double end_time = BLI_time_now_seconds();
+  const double eval_time = end_time - start_time;
+  if (state->graph->debug.trace) {
+    state->graph->debug.trace->add_operation(
+        *operation_node, state->graph->frame, start_time, end_time);
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->do_stats) {
+    operation_node->stats.current_time += eval_time;
   }
+  update_eval_time_estimate(state, operation_node, float(eval_time));
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
@@ -112,14 +152,26 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The one on the longest chain of dependencies is evaluated right away by
+     * this thread, the others are pushed to the pool. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node && next_node->critical_path_time >= node->critical_path_time) {
+        BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+        return;
+      }
+      if (next_node) {
+        BLI_task_pool_push(pool, deg_task_run_func, next_node, false, nullptr);
+      }
+      next_node = node;
+    });
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -316,9 +368,16 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  /* Start with the operations on the longest chains of dependencies. */
+  Vector<OperationNode *> ready_nodes;
+  schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+  std::stable_sort(
+      ready_nodes.begin(), ready_nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+        return a->critical_path_time > b->critical_path_time;
+      });
+  for (OperationNode *node : ready_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -384,6 +443,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   if (graph->entry_tags.is_empty()) {
     return;
   }
+  BLI_PROFILE_SCOPE("Depsgraph Evaluation");
 
   /* The update counts can be used to check if the Depsgraph was changed since the last time it was
    * cached by comparing its current update count with the one stored at the moment the Depsgraph
@@ -404,6 +464,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 #endif
 
   graph->is_evaluating = true;
+  const double start_time = graph->debug.trace ? BLI_time_now_seconds() : 0.0;
   depsgraph_ensure_view_layer(graph);
 
   /* Set up evaluation state. */
@@ -464,11 +525,18 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
   }
+  if (state.need_update_critical_path) {
+    deg_eval_critical_path_update(graph);
+  }
 
   /* Clear any uncleared tags. */
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
 
+  if (graph->debug.trace) {
+    graph->debug.trace->add_graph_evaluation(graph->frame, start_time, BLI_time_now_seconds());
+  }
+
 #ifdef WITH_PYTHON
   BPy_END_ALLOW_THREADS;
 #endif
@@ -8,7 +8,12 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+
+#include "BLI_vector.hh"
+
 #include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
 
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -37,4 +42,39 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+void deg_eval_critical_path_update(Depsgraph *graph)
+{
+  /* Traverse the graph from the operations without dependents towards the ones they depend on,
+   * ignoring the relations which are breaking dependency cycles.
+   * The custom flags store the number of dependents which are not handled yet. */
+  Vector<OperationNode *> queue;
+  for (OperationNode *op_node : graph->operations) {
+    op_node->critical_path_time = op_node->eval_time_estimate;
+    op_node->custom_flags = 0;
+    for (const Relation *rel : op_node->outlinks) {
+      if (rel->to->type == NodeType::OPERATION && (rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        op_node->custom_flags++;
+      }
+    }
+    if (op_node->custom_flags == 0) {
+      queue.append(op_node);
+    }
+  }
+
+  while (!queue.is_empty()) {
+    const OperationNode *op_node = queue.pop_last();
+    for (const Relation *rel : op_node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC) != 0) {
+        continue;
+      }
+      OperationNode *from = (OperationNode *)rel->from;
+      from->critical_path_time = std::max(from->critical_path_time,
+                                          from->eval_time_estimate + op_node->critical_path_time);
+      if (--from->custom_flags == 0) {
+        queue.append(from);
+      }
+    }
+  }
+}
+
 }  // namespace blender::deg
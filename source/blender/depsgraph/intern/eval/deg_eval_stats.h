@@ -15,4 +15,7 @@ struct Depsgraph;
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Update the critical path time of all operations from their evaluation time estimates. */
+void deg_eval_critical_path_update(Depsgraph *graph);
+
 }  // namespace blender::deg
@@ -287,6 +287,16 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Evaluation time in seconds, smoothed over the previous evaluations of this operation. */
+  float eval_time_average;
+  /* Evaluation time used for the #critical_path_time, only updated from #eval_time_average when
+   * it changes significantly. */
+  float eval_time_estimate;
+  /* Estimated time needed to evaluate this operation and the longest chain of operations which
+   * depend on it. Operations with the highest value are evaluated first, so that long chains of
+   * dependencies do not start late. */
+  float critical_path_time;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
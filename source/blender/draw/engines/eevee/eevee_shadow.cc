@@ -763,6 +763,9 @@ void ShadowModule::sync_object(const Object *ob,
   shadow_ob.used = true;
   const bool is_initialized = shadow_ob.resource_handle.raw != 0;
   const bool has_jittered_transparency = has_transparent_shadows && data_.use_jitter;
+  /* Only the pages overlapped by the previous and current bounds of updated casters are tagged
+   * for re-rendering, static casters keep their cached pages. Shading updates are included since
+   * materials can change the shadow (transparency, displacement). */
   if (is_shadow_caster && (handle.recalc || !is_initialized || has_jittered_transparency)) {
     if (handle.recalc && is_initialized) {
       past_casters_updated_.append(shadow_ob.resource_handle.raw);
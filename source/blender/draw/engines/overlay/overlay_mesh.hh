@@ -41,6 +41,10 @@ constexpr int overlay_edit_text = V3D_OVERLAY_EDIT_EDGE_LEN | V3D_OVERLAY_EDIT_F
 
 /**
  * Draw edit mesh overlays.
+ *
+ * \note These passes are #PassSimple and not #PassMain. Edit mode batches are unique to each
+ * object, so there is nothing to merge into instanced draws. The per object cost is the resource
+ * handle and one draw per pass, which is small compared to the batch extraction.
  */
 class Meshes : Overlay {
  private:
@@ -73,6 +73,10 @@ static void ensure_dependency_data(MeshRenderData &mr,
 /** \name Extract Loop
  * \{ */
 
+/* NOTE: Extraction runs directly on the calling thread, each extractor being multi-threaded over
+ * the mesh elements instead. Extracting different objects on worker threads would additionally
+ * need the batch cache of each mesh to be locked, since instances of the same mesh request
+ * buffers from the same cache during sync. */
 void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
                                         const Scene &scene,
                                         MeshBatchCache &cache,
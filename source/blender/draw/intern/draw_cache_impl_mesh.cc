@@ -1135,6 +1135,11 @@ void DRW_mesh_batch_cache_create_requested(TaskGraph &task_graph,
                                            const bool is_paint_mode,
                                            const bool use_hide)
 {
+  /* NOTE: Every batch covers the whole mesh, there is no cluster (meshlet) based path with
+   * per-view culling. The closest equivalent is sculpt mode, which draws per #bke::pbvh::Node
+   * and culls the nodes against the view frustum (see `draw_sculpt.cc`). Splitting regular meshes
+   * into clusters would need a second set of index buffers and a culling compute pass for each
+   * engine, while most meshes are small enough that this would only add overhead. */
   const ToolSettings *ts = scene.toolsettings;
 
   MeshBatchCache &cache = *mesh_batch_cache_get(mesh);
@@ -13,6 +13,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_profile.hh"
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
@@ -1294,6 +1295,7 @@ static void drw_draw_render_loop_2d(DRWContext &draw_ctx)
 
 void DRW_draw_view(const bContext *C)
 {
+  BLI_PROFILE_SCOPE("Draw View");
   Depsgraph *depsgraph = CTX_data_expect_evaluated_depsgraph(C);
   ARegion *region = CTX_wm_region(C);
   GPUViewport *viewport = WM_draw_region_get_bound_viewport(region);
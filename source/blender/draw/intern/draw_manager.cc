@@ -38,6 +38,9 @@ void Manager::begin_sync(Object *object_active)
   /* Add 2 to always have a non-null number even in case of overflow. */
   sync_counter_ = (global_sync_counter_ += 2);
 
+  /* NOTE: Object resources are rebuilt from scratch on every sync, since resource handles are
+   * given out in depsgraph iteration order, which isn't stable. Keeping these buffers resident
+   * and only updating changed objects would require persistent handles per object instance. */
   matrix_buf.swap();
   bounds_buf.swap();
   infos_buf.swap();
@@ -78,7 +78,12 @@ static Vector<SculptBatch> sculpt_batches_get_ex(const Object *ob,
     draw_frustum_planes[i] = tmat * draw_frustum_planes[i];
   }
 
-  /* Fast mode to show low poly multires while navigating. */
+  /* Fast mode to show low poly multires while navigating.
+   *
+   * NOTE: The level of detail is the same for all nodes, there is no distance based LOD per node.
+   * Neighboring nodes with a different grid level would show cracks along their borders, and
+   * #pbvh::ViewportRequest is keyed on a single coarse flag, so every mix of levels would create
+   * separate GPU buffers. Streaming is covered by only updating visible and dirty nodes below. */
   bool fast_mode = false;
   if (paint && (paint->flags & PAINT_FAST_NAVIGATE)) {
     fast_mode = navigating;
@@ -64,6 +64,11 @@ bool SELECTID_Context::is_dirty(Depsgraph *depsgraph, RegionView3D *rv3d)
 /** \name Buffer of select ID's
  * \{ */
 
+/* NOTE: Box, circle and lasso selection read the ID buffer back once and resolve the selection on
+ * the CPU. The buffer is only redrawn when the view or the depsgraph changed. Resolving on the GPU
+ * with a compute shader would replace the read-back of `rect` with a read-back of a bitmap, which
+ * is not where the time goes for dense meshes: drawing the IDs and applying the selection to the
+ * #BMesh elements are. */
 uint *DRW_select_buffer_read(
     Depsgraph *depsgraph, ARegion *region, View3D *v3d, const rcti *rect, uint *r_buf_len)
 {
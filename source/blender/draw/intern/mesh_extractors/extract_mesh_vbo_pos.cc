@@ -70,6 +70,11 @@ static void extract_positions_bm(const MeshRenderData &mr, MutableSpan<float3> v
 
 gpu::VertBufPtr extract_positions(const MeshRenderData &mr)
 {
+  /* NOTE: Positions are not quantized relative to the object bounds. Every shader that reads
+   * `pos` (overlays, selection, sculpt, all engines) would need to de-quantize it, and the
+   * precision loss is visible on large objects when zooming in on details. Index buffers
+   * are already converted to 16-bit when the index range allows it (see `IndexBuf::init`), and
+   * normals use #SNORM_10_10_10_2 unless high quality normals are requested. */
   static const GPUVertFormat format = GPU_vertformat_from_attribute(
       "pos", gpu::VertAttrType::SFLOAT_32_32_32);
   gpu::VertBufPtr vbo = gpu::VertBufPtr(GPU_vertbuf_create_with_format(format));
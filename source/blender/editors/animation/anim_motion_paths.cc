@@ -15,6 +15,8 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
 
 #include "DNA_anim_types.h"
 #include "DNA_armature_types.h"
@@ -41,6 +43,10 @@
 
 #include "CLG_log.h"
 
+#ifdef WITH_PYTHON
+#  include "BPY_extern.hh"
+#endif
+
 static CLG_LogRef LOG = {"ed.anim.motion_paths"};
 
 /* Motion path needing to be baked (mpt). */
@@ -66,10 +72,11 @@ static void motionpaths_calc_update_scene(Depsgraph *depsgraph)
   BKE_scene_graph_update_for_newframe(depsgraph);
 }
 
-Depsgraph *animviz_depsgraph_build(Main *bmain,
-                                   Scene *scene,
-                                   ViewLayer *view_layer,
-                                   blender::Span<MPathTarget *> targets)
+/* Build a dependency graph which only contains the targets, without evaluating it. */
+static Depsgraph *motionpaths_depsgraph_build_no_eval(Main *bmain,
+                                                      Scene *scene,
+                                                      ViewLayer *view_layer,
+                                                      blender::Span<MPathTarget *> targets)
 {
   /* Allocate dependency graph. */
   Depsgraph *depsgraph = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_VIEWPORT);
@@ -83,6 +90,15 @@ Depsgraph *animviz_depsgraph_build(Main *bmain,
 
   /* Build graph from all requested IDs. */
   DEG_graph_build_from_ids(depsgraph, ids);
+  return depsgraph;
+}
+
+Depsgraph *animviz_depsgraph_build(Main *bmain,
+                                   Scene *scene,
+                                   ViewLayer *view_layer,
+                                   blender::Span<MPathTarget *> targets)
+{
+  Depsgraph *depsgraph = motionpaths_depsgraph_build_no_eval(bmain, scene, view_layer, targets);
 
   /* Update once so we can access pointers of evaluated animation data. */
   motionpaths_calc_update_scene(depsgraph);
@@ -131,11 +147,16 @@ void animviz_free_motionpath_targets(blender::Vector<MPathTarget *> &targets)
 
 /* ........ */
 
-/* Perform baking for the targets on the current frame. */
+/* Perform baking for the targets on the current frame.
+ *
+ * When `update_eval_paths` is false, the motion paths of the evaluated objects are not updated.
+ * This is used when the frame is evaluated on a temporary dependency graph, possibly from a
+ * worker thread. */
 static void motionpaths_calc_bake_targets(blender::Span<MPathTarget *> targets,
                                           int cframe,
                                           Depsgraph *depsgraph,
-                                          Object *camera)
+                                          Object *camera,
+                                          const bool update_eval_paths = true)
 {
   using namespace blender;
   /* For each target, check if it can be baked on the current frame. */
@@ -152,7 +173,7 @@ static void motionpaths_calc_bake_targets(blender::Span<MPathTarget *> targets,
     /* Get the relevant cache vert to write to. */
     bMotionPathVert *mpv = mpath->points + (cframe - mpath->start_frame);
 
-    Object *ob_eval = mpt->ob_eval;
+    Object *ob_eval = update_eval_paths ? mpt->ob_eval : DEG_get_evaluated(depsgraph, mpt->ob);
 
     /* Lookup evaluated pose channel, here because the depsgraph
      * evaluation can change them so they are not cached in mpt. */
@@ -196,6 +217,10 @@ static void motionpaths_calc_bake_targets(blender::Span<MPathTarget *> targets,
       mpv->flag &= ~MOTIONPATH_VERT_KEY;
     }
 
+    if (!update_eval_paths) {
+      continue;
+    }
+
     /* Incremental update on evaluated object if possible, for fast updating
      * while dragging in transform. */
     bMotionPath *mpath_eval = nullptr;
@@ -403,6 +428,79 @@ void animviz_motionpath_compute_range(Object *ob, Scene *scene)
   ED_keylist_free(keylist);
 }
 
+/* Minimum number of frames evaluated by every dependency graph when evaluating frames in
+ * parallel, so that the cost of building and copying the graph is amortized. */
+static constexpr int MOTIONPATH_PARALLEL_MIN_FRAMES_PER_GRAPH = 8;
+/* Maximum number of dependency graphs evaluated at the same time. Every graph holds its own
+ * evaluated copy of the scene, so this bounds the memory usage. */
+static constexpr int MOTIONPATH_PARALLEL_MAX_GRAPHS = 4;
+
+static bool motionpaths_use_parallel_frames(const Scene *scene,
+                                            const eAnimvizCalcRange range,
+                                            const int frames_num)
+{
+  if ((scene->flag & SCE_PARALLEL_FRAME_EVALUATION) == 0) {
+    return false;
+  }
+  if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
+    return false;
+  }
+  return BLI_system_thread_count() > 1 &&
+         frames_num >= 2 * MOTIONPATH_PARALLEL_MIN_FRAMES_PER_GRAPH;
+}
+
+/* Evaluate the frame range on several independent dependency graphs at the same time, each of
+ * them handling a contiguous part of the range.
+ *
+ * Frame change handlers are not run for these frames, and the original scene frame is not
+ * modified. This is why this is only used when the scene is marked as safe for it. */
+static void motionpaths_calc_parallel_frames(Depsgraph *depsgraph,
+                                             Main *bmain,
+                                             Scene *scene,
+                                             blender::Span<MPathTarget *> targets,
+                                             const int sfra,
+                                             const int efra)
+{
+  using namespace blender;
+  const int frames_num = efra - sfra + 1;
+  const int graphs_num = std::min({BLI_system_thread_count(),
+                                   MOTIONPATH_PARALLEL_MAX_GRAPHS,
+                                   frames_num / MOTIONPATH_PARALLEL_MIN_FRAMES_PER_GRAPH});
+  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
+
+  /* Building is not thread-safe, so the graphs are all built upfront. */
+  Array<Depsgraph *> graphs(graphs_num);
+  for (const int i : graphs.index_range()) {
+    graphs[i] = motionpaths_depsgraph_build_no_eval(bmain, scene, view_layer, targets);
+  }
+
+  CLOG_INFO(&LOG, 1, "Evaluating MotionPaths frames on %d dependency graphs", graphs_num);
+
+  const int frames_per_graph = divide_ceil_u(frames_num, graphs_num);
+#ifdef WITH_PYTHON
+  /* Python drivers evaluated by the other threads need the GIL, which the calling thread might
+   * hold while it waits for them. The graph evaluation only releases it on the calling thread. */
+  BPy_BEGIN_ALLOW_THREADS;
+#endif
+  threading::parallel_for(graphs.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int graph_sfra = sfra + i * frames_per_graph;
+      const int graph_efra = std::min(efra, graph_sfra + frames_per_graph - 1);
+      for (int frame = graph_sfra; frame <= graph_efra; frame++) {
+        DEG_evaluate_on_framechange(graphs[i], float(frame));
+        motionpaths_calc_bake_targets(targets, frame, graphs[i], scene->camera, false);
+      }
+    }
+  });
+#ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#endif
+
+  for (Depsgraph *graph : graphs) {
+    DEG_graph_free(graph);
+  }
+}
+
 void animviz_calc_motionpaths(Depsgraph *depsgraph,
                               Main *bmain,
                               Scene *scene,
@@ -526,18 +624,23 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
             sfra,
             efra,
             efra - sfra + 1);
-  for (scene->r.cfra = sfra; scene->r.cfra <= efra; scene->r.cfra++) {
-    if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
-      /* For current frame, only update tagged. */
-      BKE_scene_graph_update_tagged(depsgraph, bmain);
-    }
-    else {
-      /* Update relevant data for new frame. */
-      motionpaths_calc_update_scene(depsgraph);
-    }
+  if (motionpaths_use_parallel_frames(scene, range, efra - sfra + 1)) {
+    motionpaths_calc_parallel_frames(depsgraph, bmain, scene, targets, sfra, efra);
+  }
+  else {
+    for (scene->r.cfra = sfra; scene->r.cfra <= efra; scene->r.cfra++) {
+      if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
+        /* For current frame, only update tagged. */
+        BKE_scene_graph_update_tagged(depsgraph, bmain);
+      }
+      else {
+        /* Update relevant data for new frame. */
+        motionpaths_calc_update_scene(depsgraph);
+      }
 
-    /* Perform baking for targets. */
-    motionpaths_calc_bake_targets(targets, scene->r.cfra, depsgraph, scene->camera);
+      /* Perform baking for targets. */
+      motionpaths_calc_bake_targets(targets, scene->r.cfra, depsgraph, scene->camera);
+    }
   }
 
   /* Reset original environment. */
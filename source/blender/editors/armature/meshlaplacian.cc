@@ -20,6 +20,7 @@
 #include "BLI_memarena.h"
 #include "BLI_ordered_edge.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -987,45 +988,57 @@ static void harmonic_ray_callback(void *userdata,
   }
 }
 
-static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
-                                                     const float co1[3],
-                                                     const float co2[3])
+/**
+ * Cast a ray from \a co1 to \a co2 against the cage, return the index of the hit triangle or -1
+ * when nothing is hit.
+ */
+static int meshdeform_ray_tree_cast(MeshDeformBind *mdb,
+                                    const float co1[3],
+                                    const float co2[3],
+                                    MeshDeformIsect *r_isect)
 {
   BVHTreeRayHit hit;
-  MeshDeformIsect isect_mdef;
   MeshRayCallbackData data = {
       mdb,
-      &isect_mdef,
+      r_isect,
   };
   float end[3], vec_normal[3];
 
   /* happens binding when a cage has no faces */
   if (UNLIKELY(mdb->bvhtree == nullptr)) {
-    return nullptr;
+    return -1;
   }
 
   /* setup isec */
-  memset(&isect_mdef, 0, sizeof(isect_mdef));
-  isect_mdef.lambda = 1e10f;
+  memset(r_isect, 0, sizeof(*r_isect));
+  r_isect->lambda = 1e10f;
 
-  copy_v3_v3(isect_mdef.start, co1);
+  copy_v3_v3(r_isect->start, co1);
   copy_v3_v3(end, co2);
-  sub_v3_v3v3(isect_mdef.vec, end, isect_mdef.start);
-  isect_mdef.vec_length = normalize_v3_v3(vec_normal, isect_mdef.vec);
+  sub_v3_v3v3(r_isect->vec, end, r_isect->start);
+  r_isect->vec_length = normalize_v3_v3(vec_normal, r_isect->vec);
 
   hit.index = -1;
   hit.dist = BVH_RAYCAST_DIST_MAX;
-  if (BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
-                              isect_mdef.start,
-                              vec_normal,
-                              0.0,
-                              &hit,
-                              harmonic_ray_callback,
-                              &data,
-                              BVH_RAYCAST_WATERTIGHT) != -1)
-  {
+  return BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
+                                 r_isect->start,
+                                 vec_normal,
+                                 0.0,
+                                 &hit,
+                                 harmonic_ray_callback,
+                                 &data,
+                                 BVH_RAYCAST_WATERTIGHT);
+}
+
+static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
+                                                     const float co1[3],
+                                                     const float co2[3])
+{
+  MeshDeformIsect isect_mdef;
+  const int tri_index = meshdeform_ray_tree_cast(mdb, co1, co2, &isect_mdef);
+  if (tri_index != -1) {
     const blender::Span<int> corner_verts = mdb->cagemesh_cache.corner_verts;
-    const int face_i = mdb->cagemesh_cache.tri_faces[hit.index];
+    const int face_i = mdb->cagemesh_cache.tri_faces[tri_index];
     const blender::IndexRange face = mdb->cagemesh_cache.faces[face_i];
     const float(*cagecos)[3] = mdb->cagecos;
     const float len = isect_mdef.lambda;
@@ -1062,10 +1075,14 @@ static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
   return nullptr;
 }
 
-static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
+/**
+ * Only needs to know which side of the cage is hit, so unlike #meshdeform_ray_tree_intersect
+ * nothing is allocated and this can be called from multiple threads.
+ */
+static int meshdeform_inside_cage(MeshDeformBind *mdb, const float co[3])
 {
-  MDefBoundIsect *isect;
-  float outside[3], start[3], dir[3];
+  MeshDeformIsect isect;
+  float outside[3];
   int i;
 
   for (i = 1; i <= 6; i++) {
@@ -1073,12 +1090,7 @@ static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
     outside[1] = co[1] + (mdb->max[1] - mdb->min[1] + 1.0f) * MESHDEFORM_OFFSET[i][1];
     outside[2] = co[2] + (mdb->max[2] - mdb->min[2] + 1.0f) * MESHDEFORM_OFFSET[i][2];
 
-    copy_v3_v3(start, co);
-    sub_v3_v3v3(dir, outside, start);
-    normalize_v3(dir);
-
-    isect = meshdeform_ray_tree_intersect(mdb, start, outside);
-    if (isect && !isect->facing) {
+    if (meshdeform_ray_tree_cast(mdb, co, outside, &isect) != -1 && !isect.isect) {
       return 1;
     }
   }
@@ -1581,7 +1593,7 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
   MDefInfluence *mdinf;
   MDefCell *cell;
   float center[3], vec[3], maxwidth, totweight;
-  int a, b, x, y, z, totinside, offset;
+  int a, b, x, y, z, offset;
 
   /* compute bounding box of the cage mesh */
   INIT_MINMAX(mdb->min, mdb->max);
@@ -1610,9 +1622,6 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
     mdb->weights = MEM_calloc_arrayN<float>(mdb->verts_num * mdb->cage_verts_num, "MDefWeights");
   }
 
-  mdb->memarena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "harmonic coords arena");
-  BLI_memarena_use_calloc(mdb->memarena);
-
   /* Initialize data from `cagedm` for reuse. */
   {
     Mesh *mesh = mdb->cagemesh;
@@ -1645,19 +1654,15 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
 
   progress_bar(0, "Setting up mesh deform system");
 
-  totinside = 0;
-  for (a = 0; a < mdb->verts_num; a++) {
-    copy_v3_v3(vec, mdb->vertexcos[a]);
-    mdb->inside[a] = meshdeform_inside_cage(mdb, vec);
-    if (mdb->inside[a]) {
-      totinside++;
-    }
-  }
-  (void)totinside; /* Quiet set-but-unused warning (may be removed). */
+  blender::threading::parallel_for(
+      blender::IndexRange(mdb->verts_num), 256, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          mdb->inside[i] = meshdeform_inside_cage(mdb, mdb->vertexcos[i]);
+        }
+      });
 
-  /* free temporary MDefBoundIsects */
-  BLI_memarena_free(mdb->memarena);
   mdb->memarena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "harmonic coords arena");
+  BLI_memarena_use_calloc(mdb->memarena);
 
   /* start with all cells untyped */
   for (a = 0; a < mdb->size3; a++) {
@@ -544,11 +544,16 @@ class AssetIndexFile : public AbstractFile {
   }
 
   /**
-   * Returns whether the index file is older than the given asset file.
+   * Returns whether the index file, with the status \a index_stat, is older than the given asset
+   * file.
    */
-  bool is_older_than(const BlendFile &asset_file) const
+  bool is_older_than(const BLI_stat_t &index_stat, const BlendFile &asset_file) const
   {
-    return BLI_file_older(this->get_file_path(), asset_file.get_file_path());
+    BLI_stat_t asset_stat;
+    if (BLI_stat(asset_file.get_file_path(), &asset_stat) == -1) {
+      return false;
+    }
+    return index_stat.st_mtime < asset_stat.st_mtime;
   }
 
   /**
@@ -560,6 +565,12 @@ class AssetIndexFile : public AbstractFile {
     return file_size >= MIN_FILE_SIZE_WITH_ENTRIES;
   }
 
+  /** Same as #constains_entries, using the already known status of the index file. */
+  bool constains_entries(const BLI_stat_t &index_stat) const
+  {
+    return size_t(index_stat.st_size) >= MIN_FILE_SIZE_WITH_ENTRIES;
+  }
+
   std::unique_ptr<AssetIndex> read_contents() const
   {
     JsonFormatter formatter;
@@ -653,7 +664,10 @@ static eFileIndexerResult read_index(const char *filename,
   BlendFile asset_file(filename);
   AssetIndexFile asset_index_file(library_index, asset_file);
 
-  if (!asset_index_file.exists()) {
+  /* Query the index file only once, asset libraries are often stored on network drives where
+   * every file system access is slow. */
+  BLI_stat_t index_stat;
+  if (BLI_stat(asset_index_file.get_file_path(), &index_stat) == -1) {
     return FILE_INDEXER_NEEDS_UPDATE;
   }
 
@@ -663,7 +677,7 @@ static eFileIndexerResult read_index(const char *filename,
    */
   asset_index_file.mark_as_used();
 
-  if (asset_index_file.is_older_than(asset_file)) {
+  if (asset_index_file.is_older_than(index_stat, asset_file)) {
     CLOG_INFO(
         &LOG,
         3,
@@ -673,7 +687,7 @@ static eFileIndexerResult read_index(const char *filename,
     return FILE_INDEXER_NEEDS_UPDATE;
   }
 
-  if (!asset_index_file.constains_entries()) {
+  if (!asset_index_file.constains_entries(index_stat)) {
     CLOG_INFO(&LOG,
               3,
               "Asset file index is to small to contain any entries. [%s]",
@@ -126,6 +126,14 @@ struct EDBMUpdate_Params {
  * So many tools call these that we better make it a generic function.
  */
 void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params);
+/**
+ * A version of #EDBM_update for tools that only moved the vertices tagged with `hflag`.
+ * Tessellation and normals are only recalculated for the faces around these vertices,
+ * which is much faster when editing a small part of a large mesh.
+ *
+ * \note Changes to the topology must use #EDBM_update instead.
+ */
+void EDBM_update_from_verts(Mesh *mesh, const EDBMUpdate_Params *params, char hflag);
 /**
  * Bad level call from Python API.
  */
@@ -2709,19 +2709,28 @@ static wmOperatorStatus edbm_do_smooth_vertex_exec(bContext *C, wmOperator *op)
 
     /* NOTE: redundant calculation could be avoided if the EDBM API could skip calculation. */
     bool calc_normals = false;
+    bool use_mirror = false;
 
     /* apply mirror */
     if (((Mesh *)obedit->data)->symmetry & ME_SYMMETRY_X) {
       EDBM_verts_mirror_apply(em, BM_ELEM_SELECT, 0);
       EDBM_verts_mirror_cache_end(em);
       calc_normals = true;
+      use_mirror = true;
     }
 
     EDBMUpdate_Params params{};
     params.calc_looptris = true;
     params.calc_normals = calc_normals;
     params.is_destructive = false;
-    EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+    if (use_mirror) {
+      /* Mirrored vertices aren't selected, update everything. */
+      EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+    }
+    else {
+      /* Only selected vertices are moved. */
+      EDBM_update_from_verts(static_cast<Mesh *>(obedit->data), &params, BM_ELEM_SELECT);
+    }
   }
 
   if (tot_selected == 0 && !tot_locked) {
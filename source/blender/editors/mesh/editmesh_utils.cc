@@ -13,6 +13,7 @@
 #include "DNA_object_types.h"
 
 #include "BLI_array.hh"
+#include "BLI_bit_vector.hh"
 #include "BLI_kdtree.h"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
@@ -1710,6 +1711,60 @@ void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params)
 #endif
 }
 
+void EDBM_update_from_verts(Mesh *mesh, const EDBMUpdate_Params *params, const char hflag)
+{
+  BMEditMesh *em = mesh->runtime->edit_mesh.get();
+  BMesh *bm = em->bm;
+  BLI_assert(!params->is_destructive);
+
+  if (!(params->calc_looptris || params->calc_normals)) {
+    EDBM_update(mesh, params);
+    return;
+  }
+
+  BM_mesh_elem_index_ensure(bm, BM_VERT);
+
+  blender::BitVector<> verts_mask(bm->totvert);
+  int verts_mask_count = 0;
+  BMIter iter;
+  BMVert *eve;
+  int i;
+  BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
+    if (BM_elem_flag_test(eve, hflag)) {
+      verts_mask[i].set();
+      verts_mask_count += 1;
+    }
+  }
+
+  /* Creating the partial update isn't free, a full update is faster when most vertices moved. */
+  if (verts_mask_count > bm->totvert / 2) {
+    EDBM_update(mesh, params);
+    return;
+  }
+
+  BMPartialUpdate_Params update_params{};
+  update_params.do_tessellate = params->calc_looptris;
+  update_params.do_normals = params->calc_normals;
+  BMPartialUpdate *bmpinfo = BM_mesh_partial_create_from_verts(
+      *bm, update_params, verts_mask, verts_mask_count);
+
+  if (params->calc_normals && params->calc_looptris) {
+    BKE_editmesh_looptris_and_normals_calc_with_partial(em, bmpinfo);
+  }
+  else if (params->calc_normals) {
+    BM_mesh_normals_update_with_partial(bm, bmpinfo);
+  }
+  else {
+    BKE_editmesh_looptris_calc_with_partial(em, bmpinfo);
+  }
+  BM_mesh_partial_destroy(bmpinfo);
+
+  EDBMUpdate_Params params_remaining = *params;
+  params_remaining.calc_looptris = false;
+  params_remaining.calc_normals = false;
+  EDBM_update(mesh, &params_remaining);
+}
+
 void EDBM_update_extern(Mesh *mesh, const bool do_tessellation, const bool is_destructive)
 {
   EDBMUpdate_Params params{};
@@ -8,6 +8,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -304,6 +305,14 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
     const std::string frame_file_name = bake::frame_to_file_name(frame);
 
+    struct FrameToWrite {
+      NodeBakeRequest *request;
+      const bake::FrameCache *frame_cache;
+      int64_t written_size = 0;
+      PackedBake packed_data;
+    };
+    Vector<FrameToWrite> frames_to_write;
+
     for (NodeBakeRequest &request : job.bake_requests) {
       NodesModifierData &nmd = *request.nmd;
       bake::ModifierCache &modifier_cache = *nmd.runtime->cache;
@@ -318,41 +327,64 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
       if (frame_cache.frame != frame) {
         continue;
       }
+      frames_to_write.append({&request, &frame_cache});
+    }
 
-      int64_t &written_size = size_by_bake.lookup_or_add(&request, 0);
-
-      if (request.path.has_value()) {
-        char meta_path[FILE_MAX];
-        BLI_path_join(meta_path,
-                      sizeof(meta_path),
-                      request.path->meta_dir.c_str(),
-                      (frame_file_name + ".json").c_str());
-        BLI_file_ensure_parent_dir_exists(meta_path);
-        bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
-        fstream meta_file{meta_path, std::ios::out};
-        bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-        written_size += blob_writer.written_size();
-        written_size += meta_file.tellp();
-      }
-      else {
-        PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(&request);
-
-        bake::MemoryBlobWriter blob_writer{frame_file_name};
-        std::ostringstream meta_file{std::ios::binary};
-        bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-
-        packed_data.meta_files.append({frame_file_name + ".json", meta_file.str()});
-        const Map<std::string, bake::MemoryBlobWriter::OutputStream> &blob_stream_by_name =
-            blob_writer.get_stream_by_name();
-        for (auto &&item : blob_stream_by_name.items()) {
-          std::string data = item.value.stream->str();
-          if (data.empty()) {
-            continue;
+    /* Every bake request has its own output files and blob sharing, so they can be serialized in
+     * parallel. Nothing is evaluated while this is running. */
+    threading::parallel_for(frames_to_write.index_range(), 1, [&](const IndexRange range) {
+      for (FrameToWrite &frame_to_write : frames_to_write.as_mutable_span().slice(range)) {
+        NodeBakeRequest &request = *frame_to_write.request;
+        const bake::FrameCache &frame_cache = *frame_to_write.frame_cache;
+        int64_t &written_size = frame_to_write.written_size;
+
+        if (request.path.has_value()) {
+          char meta_path[FILE_MAX];
+          BLI_path_join(meta_path,
+                        sizeof(meta_path),
+                        request.path->meta_dir.c_str(),
+                        (frame_file_name + ".json").c_str());
+          BLI_file_ensure_parent_dir_exists(meta_path);
+          bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
+          fstream meta_file{meta_path, std::ios::out};
+          bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+          written_size += blob_writer.written_size();
+          written_size += meta_file.tellp();
+        }
+        else {
+          PackedBake &packed_data = frame_to_write.packed_data;
+
+          bake::MemoryBlobWriter blob_writer{frame_file_name};
+          std::ostringstream meta_file{std::ios::binary};
+          bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+
+          packed_data.meta_files.append({frame_file_name + ".json", meta_file.str()});
+          const Map<std::string, bake::MemoryBlobWriter::OutputStream> &blob_stream_by_name =
+              blob_writer.get_stream_by_name();
+          for (auto &&item : blob_stream_by_name.items()) {
+            std::string data = item.value.stream->str();
+            if (data.empty()) {
+              continue;
+            }
+            packed_data.blob_files.append({item.key, std::move(data)});
           }
-          packed_data.blob_files.append({item.key, std::move(data)});
+          written_size += blob_writer.written_size();
+          written_size += meta_file.tellp();
+        }
+      }
+    });
+
+    for (FrameToWrite &frame_to_write : frames_to_write) {
+      NodeBakeRequest *request = frame_to_write.request;
+      size_by_bake.lookup_or_add(request, 0) += frame_to_write.written_size;
+      if (!request->path.has_value()) {
+        PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(request);
+        for (MemoryBakeFile &meta_file : frame_to_write.packed_data.meta_files) {
+          packed_data.meta_files.append(std::move(meta_file));
+        }
+        for (MemoryBakeFile &blob_file : frame_to_write.packed_data.blob_files) {
+          packed_data.blob_files.append(std::move(blob_file));
         }
-        written_size += blob_writer.written_size();
-        written_size += meta_file.tellp();
       }
     }
 
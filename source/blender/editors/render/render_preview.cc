@@ -1530,10 +1530,46 @@ static int icon_previewimg_size_index_get(const IconPreviewSize *icon_size,
   return -1;
 }
 
+static int icon_preview_size_cmp_larger_first(const void *a, const void *b)
+{
+  const IconPreviewSize *size_a = static_cast<const IconPreviewSize *>(a);
+  const IconPreviewSize *size_b = static_cast<const IconPreviewSize *>(b);
+  return (size_a->sizex * size_a->sizey) < (size_b->sizex * size_b->sizey);
+}
+
+/**
+ * Fill \a dst_size by scaling down the already rendered \a src_size, instead of setting up and
+ * rendering the preview scene again. Returns false if the sizes don't have the same aspect ratio.
+ */
+static bool icon_preview_downscale_size(const IconPreviewSize *src_size,
+                                        const IconPreviewSize *dst_size)
+{
+  if (src_size->rect == nullptr || dst_size->rect == nullptr ||
+      src_size->sizex * dst_size->sizey != src_size->sizey * dst_size->sizex)
+  {
+    return false;
+  }
+  ImBuf *ibuf = IMB_allocFromBuffer(
+      (const uint8_t *)src_size->rect, nullptr, src_size->sizex, src_size->sizey, 4);
+  if (ibuf == nullptr) {
+    return false;
+  }
+  IMB_scale(ibuf, dst_size->sizex, dst_size->sizey, IMBScaleFilter::Box, false);
+  memcpy(dst_size->rect,
+         ibuf->byte_buffer.data,
+         sizeof(uint) * size_t(dst_size->sizex) * size_t(dst_size->sizey));
+  IMB_freeImBuf(ibuf);
+  return true;
+}
+
 static void icon_preview_startjob_all_sizes(void *customdata, wmJobWorkerStatus *worker_status)
 {
   IconPreview *ip = (IconPreview *)customdata;
 
+  /* Render the largest size first, so the smaller ones can be scaled down from it. */
+  BLI_listbase_sort(&ip->sizes, icon_preview_size_cmp_larger_first);
+  const IconPreviewSize *rendered_size = nullptr;
+
   LISTBASE_FOREACH (IconPreviewSize *, cur_size, &ip->sizes) {
     PreviewImage *prv = static_cast<PreviewImage *>(ip->owner);
     /* Is this a render job or a deferred loading job? */
@@ -1581,6 +1617,15 @@ static void icon_preview_startjob_all_sizes(void *customdata, wmJobWorkerStatus
     }
 #endif
 
+    if (pr_method == PR_ICON_RENDER && rendered_size &&
+        icon_preview_downscale_size(rendered_size, cur_size))
+    {
+      continue;
+    }
+    if (pr_method == PR_ICON_RENDER) {
+      rendered_size = cur_size;
+    }
+
     if (ip->id != nullptr) {
       switch (GS(ip->id->name)) {
         case ID_OB:
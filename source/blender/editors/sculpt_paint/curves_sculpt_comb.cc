@@ -174,6 +174,10 @@ struct CombOperationExecutor {
     const IndexMask changed_curves_mask = IndexMask::from_bools(changed_curves, memory);
     self_->constraint_solver_.solve_step(*curves_orig_, changed_curves_mask, surface, transforms_);
 
+    /* NOTE: The brush runs on the CPU and the whole geometry is evaluated and uploaded again
+     * after every step. Running the brush on the GPU would skip the upload, but the constraint
+     * solver, the surface attachment and the modifiers evaluated on top of the original curves
+     * all need the positions on the CPU, so they would have to be read back for every step. */
     curves_orig_->tag_positions_changed();
     DEG_id_tag_update(&curves_id_orig_->id, ID_RECALC_GEOMETRY);
     WM_main_add_notifier(NC_GEOM | ND_DATA, &curves_id_orig_->id);
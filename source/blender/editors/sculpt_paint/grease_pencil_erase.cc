@@ -961,7 +961,12 @@ struct EraseOperationExecutor {
               bke::crazyspace::get_evaluated_grease_pencil_drawing_deformation(
                   ob_eval, *obact, layer_index, frame_number);
 
-          /* Compute screen space positions. */
+          /* Compute screen space positions.
+           *
+           * NOTE: All points are projected for every sample, because the deformation and the view
+           * can change during the stroke. A spatial index over the strokes would have to be
+           * rebuilt from these positions every time, so the strokes are tested directly (in
+           * parallel) instead. */
           Array<float2> screen_space_positions(src.points_num());
           threading::parallel_for(src.points_range(), 4096, [&](const IndexRange src_points) {
             for (const int src_point : src_points) {
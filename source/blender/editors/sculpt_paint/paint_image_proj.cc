@@ -1797,6 +1797,13 @@ static int project_paint_pixel_sizeof(const short brush_type)
   return sizeof(ProjPixel);
 }
 
+/**
+ * Ensure the undo tile for the pixel at tile coordinates `tx`, `ty` exists.
+ *
+ * \note The lock is only held to claim the tile and to publish it, copying the tile into the undo
+ * map happens outside of it. Once a tile exists there is no locking at all, so contention is
+ * limited to the first pixels touched in every tile. A lock per tile would not reduce it further.
+ */
 static int project_paint_undo_subtiles(const TileInfo *tinf, int tx, int ty)
 {
   ProjPaintImage *pjIma = tinf->pjima;
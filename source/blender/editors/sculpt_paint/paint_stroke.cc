@@ -809,7 +809,12 @@ static float paint_space_stroke_spacing_variable(bContext *C,
 }
 
 /* For brushes with stroke spacing enabled, moves mouse in steps
- * towards the final mouse location. */
+ * towards the final mouse location.
+ *
+ * NOTE: Each step is applied before the next one is computed. The brush of the next step gathers
+ * its nodes, raycasts and samples the surface based on the positions written by the previous
+ * step, so the steps can't be pipelined without changing the result. Each step already
+ * distributes its work over the nodes on multiple threads. */
 static int paint_space_stroke(bContext *C,
                               wmOperator *op,
                               PaintStroke *stroke,
@@ -644,6 +644,11 @@ void calc_vert_factors(const Depsgraph &depsgraph,
   }
 
   for (const int i : verts.index_range()) {
+    /* Automasking only ever reduces the factors, skip the vertices that are already masked out
+     * (for example by the brush falloff) to avoid the occlusion and topology checks. */
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const int vert = verts[i];
     const float3 &normal = orig_normals.is_empty() ? vert_normals[vert] : orig_normals[i];
 
@@ -878,6 +883,9 @@ void calc_grids_factors(const Depsgraph &depsgraph,
     const int grids_start = grids[i] * key.grid_area;
     for (const int offset : IndexRange(key.grid_area)) {
       const int node_vert = node_start + offset;
+      if (factors[node_vert] == 0.0f) {
+        continue;
+      }
       const int vert = grids_start + offset;
       const float3 &normal = orig_normals.is_empty() ? subdiv_ccg.normals[vert] :
                                                        orig_normals[node_vert];
@@ -994,6 +1002,9 @@ void calc_vert_factors(const Depsgraph &depsgraph,
   int i = 0;
   for (BMVert *vert : verts) {
     BLI_SCOPED_DEFER([&]() { i++; });
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const int vert_i = BM_elem_index_get(vert);
     const float3 normal = orig_normals.is_empty() ? float3(vert->no) : orig_normals[i];
 
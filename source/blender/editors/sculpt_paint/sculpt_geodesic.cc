@@ -12,6 +12,8 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
+#include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -83,13 +85,9 @@ Array<float> distances_create(const Span<float3> vert_positions,
   BLI_LINKSTACK_INIT(queue);
   BLI_LINKSTACK_INIT(queue_next);
 
-  for (const int i : vert_positions.index_range()) {
-    if (initial_verts.contains(i)) {
-      dists[i] = 0.0f;
-    }
-    else {
-      dists[i] = FLT_MAX;
-    }
+  dists.fill(FLT_MAX);
+  for (const int i : initial_verts) {
+    dists[i] = 0.0f;
   }
 
   /* Masks vertices that are further than limit radius from an initial vertex. As there is no need
@@ -105,14 +103,17 @@ Array<float> distances_create(const Span<float3> vert_positions,
     /* This is an O(n^2) loop used to limit the geodesic distance calculation to a radius. When
      * this optimization is needed, it is expected for the tool to request the distance to a low
      * number of vertices (usually just 1 or 2). */
-    for (const int v : initial_verts) {
-      const float *v_co = vert_positions[v];
-      for (const int i : vert_positions.index_range()) {
-        if (len_squared_v3v3(v_co, vert_positions[i]) <= limit_radius_sq) {
-          affected_vert[i].set();
-        }
-      }
-    }
+    threading::parallel_for_aligned(
+        vert_positions.index_range(), 4096, bits::BitsPerInt, [&](const IndexRange range) {
+          for (const int v : initial_verts) {
+            const float3 &v_co = vert_positions[v];
+            for (const int i : range) {
+              if (math::distance_squared(v_co, vert_positions[i]) <= limit_radius_sq) {
+                affected_vert[i].set();
+              }
+            }
+          }
+        });
   }
 
   /* Add edges adjacent to an initial vertex to the queue. */
@@ -1801,14 +1801,17 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
   }
   step_data->undo_nodes_by_pbvh_node.clear();
 
-  /* We don't need normals in the undo stack. */
+  /* We don't need normals in the undo stack. When #Node.orig_position is stored, restoring only
+   * uses it and #Node.position is only needed for original data lookup during the stroke. */
   for (std::unique_ptr<Node> &unode : step_data->nodes) {
     unode->normal = {};
+    if (!unode->orig_position.is_empty()) {
+      unode->position = {};
+    }
   }
-  /* TODO: When #Node.orig_positions is stored, #Node.positions is unnecessary, don't keep it in
-   * the stored undo step. In the future the stored undo step should use a different format with
-   * just one positions array that has a different semantic meaning depending on whether there are
-   * deform modifiers. */
+  /* TODO: In the future the stored undo step should use a different format with just one
+   * positions array that has a different semantic meaning depending on whether there are deform
+   * modifiers. */
 
   step_data->undo_size = threading::parallel_reduce(
       step_data->nodes.index_range(),
@@ -1040,7 +1040,10 @@ void ED_spacetype_file()
 
 void ED_file_init()
 {
-  ED_file_read_bookmarks();
+  /* Bookmarks are only used by the file browser, skip reading them for faster background jobs. */
+  if (G.background == false) {
+    ED_file_read_bookmarks();
+  }
   IMB_thumb_makedirs();
 }
 
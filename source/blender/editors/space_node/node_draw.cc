@@ -1779,6 +1779,11 @@ static void create_inspection_string_for_geometry_info(const geo_log::GeometryIn
       fmt::format_to(fmt::appender(buf), ".\n");
     }
   }
+  if (value_log.memory_bytes > 0) {
+    char str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+    BLI_str_format_byte_unit(str, value_log.memory_bytes, false);
+    fmt::format_to(fmt::appender(buf), fmt::runtime(TIP_("\nMemory: {}")), str);
+  }
 }
 
 static void create_inspection_string_for_geometry_socket(fmt::memory_buffer &buf,
@@ -3750,6 +3750,12 @@ static void outliner_draw_highlights(uint pos,
   tree_iterator::all_open(*space_outliner, [&](const TreeElement *te) {
     const TreeStoreElem *tselem = TREESTORE(te);
     const int start_y = *io_start_y;
+    *io_start_y -= UI_UNIT_Y;
+
+    /* Only draw the rows in view, with many selected elements drawing them all is slow. */
+    if (start_y + UI_UNIT_Y < region->v2d.cur.ymin || start_y > region->v2d.cur.ymax) {
+      return;
+    }
 
     const float ufac = UI_UNIT_X / 20.0f;
     const float radius = UI_UNIT_Y / 8.0f;
@@ -3818,8 +3824,6 @@ static void outliner_draw_highlights(uint pos,
         }
       }
     }
-
-    *io_start_y -= UI_UNIT_Y;
   });
 }
 
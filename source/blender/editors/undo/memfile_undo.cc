@@ -307,17 +307,9 @@ static void memfile_undosys_step_decode(
 
 static void memfile_undosys_step_free(UndoStep *us_p)
 {
-  /* To avoid unnecessary slow down, free backwards
-   * (so we don't need to merge when clearing all). */
+  /* Chunk memory is shared with other steps through implicit sharing, so the step can be freed
+   * on its own without moving data to the next one. */
   MemFileUndoStep *us = (MemFileUndoStep *)us_p;
-  if (us_p->next != nullptr) {
-    UndoStep *us_next_p = BKE_undosys_step_same_type_next(us_p);
-    if (us_next_p != nullptr) {
-      MemFileUndoStep *us_next = (MemFileUndoStep *)us_next_p;
-      BLO_memfile_merge(&us->data->memfile, &us_next->data->memfile);
-    }
-  }
-
   BKE_memfile_undo_free(us->data);
 }
 
@@ -15,6 +15,7 @@
 
 #include "../geometry/GeomUtils.h"
 
+#include "BLI_assert.h"
 #include "BLI_sys_types.h"
 
 namespace Freestyle {
@@ -81,10 +82,12 @@ void ViewMap::Clean()
   }
 }
 
-ViewShape *ViewMap::viewShape(uint id)
+ViewShape *ViewMap::viewShape(uint id) const
 {
-  int index = _shapeIdToIndex[id];
-  return _VShapes[index];
+  /* Called from multiple threads while computing visibility, so this must not insert. */
+  const id_to_index_map::const_iterator it = _shapeIdToIndex.find(id);
+  BLI_assert(it != _shapeIdToIndex.end());
+  return _VShapes[it->second];
 }
 
 void ViewMap::AddViewShape(ViewShape *iVShape)
@@ -138,7 +138,7 @@ class ViewMap {
     return _VEdges.size();
   }
 
-  ViewShape *viewShape(uint id);
+  ViewShape *viewShape(uint id) const;
 
   id_to_index_map &shapeIdToIndexMap()
   {
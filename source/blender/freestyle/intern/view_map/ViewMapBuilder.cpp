@@ -8,6 +8,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -27,6 +28,7 @@
 #include "../winged_edge/WFillGrid.h"
 
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 
 #include "BKE_global.hh"
 
@@ -638,13 +640,11 @@ static void computeCumulativeVisibility(ViewMap *ioViewMap,
 }
 
 template<typename G, typename I>
-static void computeDetailedVisibility(ViewMap *ioViewMap,
-                                      G &grid,
-                                      real epsilon,
-                                      RenderMonitor *iRenderMonitor)
+static void computeDetailedVisibilityForViewEdge(ViewMap *ioViewMap,
+                                                 G &grid,
+                                                 real epsilon,
+                                                 ViewEdge *ve)
 {
-  vector<ViewEdge *> &vedges = ioViewMap->ViewEdges();
-
   FEdge *fe, *festart;
   int nSamples = 0;
   vector<WFace *> wFaces;
@@ -653,174 +653,192 @@ static void computeDetailedVisibility(ViewMap *ioViewMap,
   uint qiClasses[256];
   uint maxIndex, maxCard;
   uint qiMajority;
-  for (vector<ViewEdge *>::iterator ve = vedges.begin(), veend = vedges.end(); ve != veend; ve++) {
-    if (iRenderMonitor && iRenderMonitor->testBreak()) {
-      break;
-    }
+
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "Processing ViewEdge " << (*ve)->getId() << endl;
-    }
+  if (_global.debug & G_DEBUG_FREESTYLE) {
+    cout << "Processing ViewEdge " << ve->getId() << endl;
+  }
 #endif
-    // Find an edge to test
-    if (!(*ve)->isInImage()) {
-      // This view edge has been proscenium culled
-      (*ve)->setQI(255);
-      (*ve)->setaShape(nullptr);
+  // Find an edge to test
+  if (!ve->isInImage()) {
+    // This view edge has been proscenium culled
+    ve->setQI(255);
+    ve->setaShape(nullptr);
 #if LOGGING
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "\tCulled." << endl;
-      }
-#endif
-      continue;
+    if (_global.debug & G_DEBUG_FREESTYLE) {
+      cout << "\tCulled." << endl;
     }
+#endif
+    return;
+  }
 
-    // Test edge
-    festart = (*ve)->fedgeA();
-    fe = (*ve)->fedgeA();
-    qiMajority = 0;
-    do {
-      if (fe != nullptr && fe->isInImage()) {
-        qiMajority++;
-      }
-      fe = fe->nextEdge();
-    } while (fe && fe != festart);
-
-    if (qiMajority == 0) {
-      // There are no occludable FEdges on this ViewEdge
-      // This should be impossible.
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "View Edge in viewport without occludable FEdges: " << (*ve)->getId() << endl;
-      }
-      // We can recover from this error:
-      // Treat this edge as fully visible with no occludee
-      (*ve)->setQI(0);
-      (*ve)->setaShape(nullptr);
-      continue;
+  // Test edge
+  festart = ve->fedgeA();
+  fe = ve->fedgeA();
+  qiMajority = 0;
+  do {
+    if (fe != nullptr && fe->isInImage()) {
+      qiMajority++;
     }
+    fe = fe->nextEdge();
+  } while (fe && fe != festart);
 
-    ++qiMajority;
-    qiMajority >>= 1;
-
-#if LOGGING
+  if (qiMajority == 0) {
+    // There are no occludable FEdges on this ViewEdge
+    // This should be impossible.
     if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tqiMajority: " << qiMajority << endl;
+      cout << "View Edge in viewport without occludable FEdges: " << ve->getId() << endl;
     }
-#endif
+    // We can recover from this error:
+    // Treat this edge as fully visible with no occludee
+    ve->setQI(0);
+    ve->setaShape(nullptr);
+    return;
+  }
 
-    tmpQI = 0;
-    maxIndex = 0;
-    maxCard = 0;
-    nSamples = 0;
-    memset(qiClasses, 0, 256 * sizeof(*qiClasses));
-    set<ViewShape *> foundOccluders;
+  ++qiMajority;
+  qiMajority >>= 1;
 
-    fe = (*ve)->fedgeA();
-    do {
-      if (fe == nullptr || !fe->isInImage()) {
-        fe = fe->nextEdge();
-        continue;
-      }
-      if (maxCard < qiMajority) {
-        // ARB: change &wFace to wFace and use reference in called function
-        tmpQI = computeVisibility<G, I>(
-            ioViewMap, fe, grid, epsilon, *ve, &wFace, &foundOccluders);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: visibility " << tmpQI << endl;
-        }
+  if (_global.debug & G_DEBUG_FREESTYLE) {
+    cout << "\tqiMajority: " << qiMajority << endl;
+  }
 #endif
 
-        // ARB: This is an error condition, not an alert condition.
-        // Some sort of recovery or abort is necessary.
-        if (tmpQI >= 256) {
-          cerr << "Warning: too many occluding levels" << endl;
-          // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
-          tmpQI = 255;
-        }
+  tmpQI = 0;
+  maxIndex = 0;
+  maxCard = 0;
+  nSamples = 0;
+  memset(qiClasses, 0, 256 * sizeof(*qiClasses));
+  set<ViewShape *> foundOccluders;
 
-        if (++qiClasses[tmpQI] > maxCard) {
-          maxCard = qiClasses[tmpQI];
-          maxIndex = tmpQI;
-        }
-      }
-      else {
-        // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
-        // ARB: change &wFace to wFace and use reference in called function
-        findOccludee<G, I>(fe, grid, epsilon, *ve, &wFace);
+  fe = ve->fedgeA();
+  do {
+    if (fe == nullptr || !fe->isInImage()) {
+      fe = fe->nextEdge();
+      continue;
+    }
+    if (maxCard < qiMajority) {
+      // ARB: change &wFace to wFace and use reference in called function
+      tmpQI = computeVisibility<G, I>(ioViewMap, fe, grid, epsilon, ve, &wFace, &foundOccluders);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found") << ")"
-               << endl;
-        }
+      if (_global.debug & G_DEBUG_FREESTYLE) {
+        cout << "\tFEdge: visibility " << tmpQI << endl;
+      }
 #endif
+
+      // ARB: This is an error condition, not an alert condition.
+      // Some sort of recovery or abort is necessary.
+      if (tmpQI >= 256) {
+        cerr << "Warning: too many occluding levels" << endl;
+        // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
+        tmpQI = 255;
       }
 
-      // Store test results
-      if (wFace) {
-        vector<Vec3r> vertices;
-        for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
-          vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
-        }
-        Polygon3r poly(vertices, wFace->GetNormal());
-        poly.userdata = (void *)wFace;
-        fe->setaFace(poly);
-        wFaces.push_back(wFace);
-        fe->setOccludeeEmpty(false);
+      if (++qiClasses[tmpQI] > maxCard) {
+        maxCard = qiClasses[tmpQI];
+        maxIndex = tmpQI;
+      }
+    }
+    else {
+      // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
+      // ARB: change &wFace to wFace and use reference in called function
+      findOccludee<G, I>(fe, grid, epsilon, ve, &wFace);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFound occludee" << endl;
-        }
+      if (_global.debug & G_DEBUG_FREESTYLE) {
+        cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found") << ")"
+             << endl;
+      }
 #endif
+    }
+
+    // Store test results
+    if (wFace) {
+      vector<Vec3r> vertices;
+      for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
+        vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
       }
-      else {
-        fe->setOccludeeEmpty(true);
+      Polygon3r poly(vertices, wFace->GetNormal());
+      poly.userdata = (void *)wFace;
+      fe->setaFace(poly);
+      wFaces.push_back(wFace);
+      fe->setOccludeeEmpty(false);
+#if LOGGING
+      if (_global.debug & G_DEBUG_FREESTYLE) {
+        cout << "\tFound occludee" << endl;
       }
+#endif
+    }
+    else {
+      fe->setOccludeeEmpty(true);
+    }
 
-      ++nSamples;
-      fe = fe->nextEdge();
-    } while ((maxCard < qiMajority) && (fe) && (fe != festart));
+    ++nSamples;
+    fe = fe->nextEdge();
+  } while ((maxCard < qiMajority) && (fe) && (fe != festart));
 
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
-    }
+  if (_global.debug & G_DEBUG_FREESTYLE) {
+    cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
+  }
 #endif
 
-    // ViewEdge
-    // qi --
-    (*ve)->setQI(maxIndex);
-    // occluders --
-    // I would rather not have to go through the effort of creating this this set and then copying
-    // out its contents. Is there a reason why ViewEdge::_Occluders cannot be converted to a set<>?
-    for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
-         o != oend;
-         ++o)
-    {
-      (*ve)->AddOccluder(*o);
-    }
+  // ViewEdge
+  // qi --
+  ve->setQI(maxIndex);
+  // occluders --
+  // I would rather not have to go through the effort of creating this this set and then copying
+  // out its contents. Is there a reason why ViewEdge::_Occluders cannot be converted to a set<>?
+  for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
+       o != oend;
+       ++o)
+  {
+    ve->AddOccluder(*o);
+  }
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tConclusion: QI = " << maxIndex << ", " << (*ve)->occluders_size() << " occluders."
-           << endl;
-    }
+  if (_global.debug & G_DEBUG_FREESTYLE) {
+    cout << "\tConclusion: QI = " << maxIndex << ", " << ve->occluders_size() << " occluders."
+         << endl;
+  }
 #endif
-    // occludee --
-    if (!wFaces.empty()) {
-      if (wFaces.size() <= float(nSamples) / 2.0f) {
-        (*ve)->setaShape(nullptr);
-      }
-      else {
-        ViewShape *vshape = ioViewMap->viewShape(
-            (*wFaces.begin())->GetVertex(0)->shape()->GetId());
-        (*ve)->setaShape(vshape);
-      }
+  // occludee --
+  if (!wFaces.empty()) {
+    if (wFaces.size() <= float(nSamples) / 2.0f) {
+      ve->setaShape(nullptr);
+    }
+    else {
+      ViewShape *vshape = ioViewMap->viewShape((*wFaces.begin())->GetVertex(0)->shape()->GetId());
+      ve->setaShape(vshape);
     }
-
-    wFaces.clear();
   }
 }
 
+template<typename G, typename I>
+static void computeDetailedVisibility(ViewMap *ioViewMap,
+                                      G &grid,
+                                      real epsilon,
+                                      RenderMonitor *iRenderMonitor)
+{
+  vector<ViewEdge *> &vedges = ioViewMap->ViewEdges();
+
+  // The view edges are independent: the grid is only read, and the results are written to the
+  // view edge and its own FEdges.
+  std::atomic<bool> is_break = false;
+  blender::threading::parallel_for(
+      blender::IndexRange(vedges.size()), 64, [&](const blender::IndexRange range) {
+        if (is_break) {
+          return;
+        }
+        if (iRenderMonitor && iRenderMonitor->testBreak()) {
+          is_break = true;
+          return;
+        }
+        for (const int64_t i : range) {
+          computeDetailedVisibilityForViewEdge<G, I>(ioViewMap, grid, epsilon, vedges[i]);
+        }
+      });
+}
+
 template<typename G, typename I>
 static void computeFastVisibility(ViewMap *ioViewMap, G &grid, real epsilon)
 {
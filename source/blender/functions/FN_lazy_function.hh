@@ -250,6 +250,12 @@ class LazyFunction {
    * Allow executing the function even if previously requested values are not yet available.
    */
   bool allow_missing_requested_inputs_ = false;
+  /**
+   * Hint that executing the function likely takes a while. Schedulers may start such functions
+   * before others that are ready at the same time, so that the remaining work can be done on other
+   * threads in the mean-time.
+   */
+  bool is_expensive_ = false;
 
  public:
   virtual ~LazyFunction() = default;
@@ -313,6 +319,11 @@ class LazyFunction {
     return allow_missing_requested_inputs_;
   }
 
+  bool is_expensive() const
+  {
+    return is_expensive_;
+  }
+
  private:
   /**
    * Needs to be implemented by subclasses. This is separate from #execute so that additional
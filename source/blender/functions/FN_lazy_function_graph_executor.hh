@@ -11,6 +11,9 @@
  * another #Graph again).
  */
 
+#include <atomic>
+
+#include "BLI_array.hh"
 #include "BLI_generic_pointer.hh"
 #include "BLI_vector.hh"
 
@@ -105,6 +108,12 @@ class GraphExecutor : public LazyFunction {
    * Optional wrapper for node execution functions.
    */
   const NodeExecuteWrapper *node_execute_wrapper_;
+  /**
+   * Remembers for every node whether it indicated that it takes a while to execute (see
+   * #lazy_threading::send_hint) in a previous execution. Such nodes are scheduled before other
+   * nodes in later executions, just like functions that are known to be expensive.
+   */
+  mutable Array<std::atomic<bool>> node_is_expensive_at_runtime_;
 
   /**
    * When a graph is executed, various things have to be allocated (e.g. the state of all nodes).
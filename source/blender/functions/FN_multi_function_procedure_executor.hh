@@ -12,7 +12,15 @@
 
 namespace blender::fn::multi_function {
 
-/** A multi-function that executes a procedure internally. */
+/**
+ * A multi-function that executes a procedure internally.
+ *
+ * Instructions are interpreted, but each call instruction processes a whole chunk of indices at
+ * once. Since built-in functions are usually devirtualized (see #build::exec_presets), the
+ * interpretation overhead is per chunk and not per element. Chunks are kept small enough (see
+ * #get_execution_hints) that intermediate arrays are likely to stay in the CPU cache between
+ * instructions.
+ */
 class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
@@ -373,14 +373,11 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         procedure, scope, field_tree_info, varying_fields_to_evaluate);
     mf::ProcedureExecutor procedure_executor{procedure};
 
-    mf::ParamsBuilder mf_params{procedure_executor, &mask};
-    mf::ContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
-
+    /* Buffers that the procedure writes its outputs into. Outputs without a buffer are streamed
+     * into their destination virtual array in chunks, which avoids allocating a temporary array
+     * for the entire mask. */
+    Vector<GMutableSpan> output_spans;
+    Vector<GVMutableArray> streamed_dst_varrays;
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
       const CPPType &type = field.cpp_type();
@@ -388,10 +385,9 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
 
       /* Try to get an existing virtual array that the result should be written into. */
       GVMutableArray dst_varray = get_dst_varray(out_index);
-      void *buffer;
-      if (!dst_varray || !dst_varray.is_span()) {
+      if (!dst_varray) {
         /* Allocate a new buffer for the computed result. */
-        buffer = scope.allocator().allocate_array(type, array_size);
+        void *buffer = scope.allocator().allocate_array(type, array_size);
 
         if (!type.is_trivially_destructible) {
           /* Destruct values in the end. */
@@ -400,21 +396,93 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         }
 
         r_varrays[out_index] = GVArray::ForSpan({type, buffer, array_size});
+        output_spans.append({type, buffer, array_size});
+        streamed_dst_varrays.append({});
       }
-      else {
+      else if (dst_varray.is_span()) {
         /* Write the result into the existing span. */
-        buffer = dst_varray.get_internal_span().data();
-
+        output_spans.append(dst_varray.get_internal_span().take_front(array_size));
+        streamed_dst_varrays.append({});
+        r_varrays[out_index] = dst_varray;
+        is_output_written_to_dst[out_index] = true;
+      }
+      else {
+        output_spans.append(GMutableSpan(type));
+        streamed_dst_varrays.append(dst_varray);
         r_varrays[out_index] = dst_varray;
         is_output_written_to_dst[out_index] = true;
       }
+    }
 
-      /* Pass output buffer to the procedure executor. */
-      const GMutableSpan span{type, buffer, array_size};
-      mf_params.add_uninitialized_single_output(span);
+    const bool has_streamed_outputs = std::any_of(
+        streamed_dst_varrays.begin(), streamed_dst_varrays.end(), [](const GVMutableArray &v) {
+          return bool(v);
+        });
+
+    if (!has_streamed_outputs) {
+      mf::ParamsBuilder mf_params{procedure_executor, &mask};
+      mf::ContextBuilder mf_context;
+
+      /* Provide inputs to the procedure executor. */
+      for (const GVArray &varray : field_context_inputs) {
+        mf_params.add_readonly_single_input(varray);
+      }
+      /* Pass output buffers to the procedure executor. */
+      for (const GMutableSpan &span : output_spans) {
+        mf_params.add_uninitialized_single_output(span);
+      }
+
+      procedure_executor.call_auto(mask, mf_params, mf_context);
     }
+    else {
+      /* Evaluate in chunks and copy the results of streamed outputs into their destination
+       * directly, while they are still in the CPU cache. */
+      constexpr int64_t chunk_size = 4096;
+      threading::parallel_for(mask.index_range(), chunk_size, [&](const IndexRange range) {
+        const IndexMask sliced_mask = mask.slice(range);
+        const int64_t offset = sliced_mask.first();
+        const IndexRange slice_range(offset, sliced_mask.last() - offset + 1);
+        IndexMaskMemory memory;
+        const IndexMask shifted_mask = mask.slice_and_shift(range, -offset, memory);
+
+        /* The buffer fits the output of a whole chunk with up to 16 bytes per element, which
+         * avoids heap allocations for every chunk in the common case of a single output. */
+        AlignedBuffer<chunk_size * 16, 64> allocator_buffer;
+        LinearAllocator<> allocator;
+        allocator.provide_buffer(allocator_buffer);
+        mf::ParamsBuilder mf_params{procedure_executor, &shifted_mask};
+        mf::ContextBuilder mf_context;
+        for (const GVArray &varray : field_context_inputs) {
+          mf_params.add_readonly_single_input(varray.slice(slice_range));
+        }
+        Vector<GMutableSpan> chunk_spans;
+        for (const int i : output_spans.index_range()) {
+          if (streamed_dst_varrays[i]) {
+            const CPPType &type = output_spans[i].type();
+            chunk_spans.append(
+                {type, allocator.allocate_array(type, slice_range.size()), slice_range.size()});
+            mf_params.add_uninitialized_single_output(chunk_spans.last());
+          }
+          else {
+            mf_params.add_uninitialized_single_output(output_spans[i].slice(slice_range));
+          }
+        }
+
+        procedure_executor.call(shifted_mask, mf_params, mf_context);
 
-    procedure_executor.call_auto(mask, mf_params, mf_context);
+        int chunk_span_index = 0;
+        for (const int i : output_spans.index_range()) {
+          GVMutableArray dst_varray = streamed_dst_varrays[i];
+          if (!dst_varray) {
+            continue;
+          }
+          const GMutableSpan chunk_span = chunk_spans[chunk_span_index++];
+          shifted_mask.foreach_index([&](const int64_t index) {
+            dst_varray.set_by_relocate(index + offset, chunk_span[index]);
+          });
+        }
+      });
+    }
   }
 
   /* Evaluate constant fields if necessary. */
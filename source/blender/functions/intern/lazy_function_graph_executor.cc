@@ -219,16 +219,24 @@ class GraphExecutorLFParams;
  */
 struct ScheduledNodes {
  private:
-  /** Use two stacks of scheduled nodes for different priorities. */
+  /**
+   * Use separate stacks of scheduled nodes for different priorities. Priority nodes are run first
+   * because they are usually quick and free up memory. Expensive nodes are run before normal nodes
+   * so that the remaining nodes can be moved to other threads while they are running.
+   */
   Vector<const FunctionNode *> priority_;
+  Vector<const FunctionNode *> expensive_;
   Vector<const FunctionNode *> normal_;
 
  public:
-  void schedule(const FunctionNode &node, const bool is_priority)
+  void schedule(const FunctionNode &node, const bool is_priority, const bool is_expensive)
   {
     if (is_priority) {
       this->priority_.append(&node);
     }
+    else if (is_expensive) {
+      this->expensive_.append(&node);
+    }
     else {
       this->normal_.append(&node);
     }
@@ -239,6 +247,9 @@ struct ScheduledNodes {
     if (!this->priority_.is_empty()) {
       return this->priority_.pop_last();
     }
+    if (!this->expensive_.is_empty()) {
+      return this->expensive_.pop_last();
+    }
     if (!this->normal_.is_empty()) {
       return this->normal_.pop_last();
     }
@@ -247,12 +258,12 @@ struct ScheduledNodes {
 
   bool is_empty() const
   {
-    return this->priority_.is_empty() && this->normal_.is_empty();
+    return this->priority_.is_empty() && this->expensive_.is_empty() && this->normal_.is_empty();
   }
 
   int64_t nodes_num() const
   {
-    return priority_.size() + normal_.size();
+    return priority_.size() + expensive_.size() + normal_.size();
   }
 
   /**
@@ -262,10 +273,13 @@ struct ScheduledNodes {
   {
     BLI_assert(this != &other);
     const int64_t priority_split = priority_.size() / 2;
+    const int64_t expensive_split = expensive_.size() / 2;
     const int64_t normal_split = normal_.size() / 2;
     other.priority_.extend(priority_.as_span().drop_front(priority_split));
+    other.expensive_.extend(expensive_.as_span().drop_front(expensive_split));
     other.normal_.extend(normal_.as_span().drop_front(normal_split));
     priority_.resize(priority_split);
+    expensive_.resize(expensive_split);
     normal_.resize(normal_split);
   }
 };
@@ -741,12 +755,16 @@ class Executor {
       case NodeScheduleState::NotScheduled: {
         locked_node.node_state.schedule_state = NodeScheduleState::Scheduled;
         const FunctionNode &node = static_cast<const FunctionNode &>(locked_node.node);
+        const bool is_expensive =
+            node.function().is_expensive() ||
+            self_.node_is_expensive_at_runtime_[node.index_in_graph()].load(
+                std::memory_order_relaxed);
         if (this->use_multi_threading()) {
           std::lock_guard lock{current_task.mutex};
-          current_task.scheduled_nodes.schedule(node, is_priority);
+          current_task.scheduled_nodes.schedule(node, is_priority, is_expensive);
         }
         else {
-          current_task.scheduled_nodes.schedule(node, is_priority);
+          current_task.scheduled_nodes.schedule(node, is_priority, is_expensive);
         }
         current_task.has_scheduled_nodes.store(true, std::memory_order_relaxed);
         break;
@@ -1437,6 +1455,8 @@ inline void Executor::execute_node(const FunctionNode &node,
    * the execution will take a while. In this case, other tasks waiting on this thread should be
    * allowed to be picked up by another thread. */
   auto blocking_hint_fn = [&]() {
+    self_.node_is_expensive_at_runtime_[node.index_in_graph()].store(true,
+                                                                     std::memory_order_relaxed);
     if (!current_task.has_scheduled_nodes.load()) {
       return;
     }
@@ -1485,7 +1505,8 @@ GraphExecutor::GraphExecutor(const Graph &graph,
       graph_output_index_by_socket_index_(graph.graph_outputs().size(), -1),
       logger_(logger),
       side_effect_provider_(side_effect_provider),
-      node_execute_wrapper_(node_execute_wrapper)
+      node_execute_wrapper_(node_execute_wrapper),
+      node_is_expensive_at_runtime_(graph.nodes().size())
 {
   debug_name_ = graph.name().c_str();
 
@@ -1505,6 +1526,10 @@ GraphExecutor::GraphExecutor(const Graph &graph,
     graph_output_index_by_socket_index_[socket.index()] = i;
   }
 
+  for (std::atomic<bool> &is_expensive : node_is_expensive_at_runtime_) {
+    is_expensive.store(false, std::memory_order_relaxed);
+  }
+
   /* Preprocess buffer offsets. */
   int offset = 0;
   const Span<const Node *> nodes = graph_.nodes();
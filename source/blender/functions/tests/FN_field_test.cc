@@ -5,6 +5,7 @@
 #include "testing/testing.h"
 
 #include "BLI_cpp_type.hh"
+#include "BLI_math_vector_types.hh"
 #include "FN_field.hh"
 #include "FN_multi_function_builder.hh"
 #include "FN_multi_function_test_common.hh"
@@ -149,6 +150,42 @@ TEST(field, TwoFunctions)
   EXPECT_EQ(result[8], 26);
 }
 
+static int get_int2_x(const int2 &value)
+{
+  return value.x;
+}
+
+static void set_int2_x(int2 &value, const int x)
+{
+  value.x = x;
+}
+
+TEST(field, NonSpanDestination)
+{
+  GField index_field{std::make_shared<IndexFieldInput>()};
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+  GField add_field{FieldOperation::Create(add_fn, {index_field, index_field}), 0};
+
+  /* Use enough elements so that the result is written in multiple chunks. */
+  Array<int2> result(20000, int2(-1));
+  VMutableArray<int> result_x =
+      VMutableArray<int>::ForDerivedSpan<int2, get_int2_x, set_int2_x>(result);
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      result.index_range(), GrainSize(1024), memory, [](const int64_t i) { return i % 3 != 0; });
+
+  FieldContext context;
+  FieldEvaluator evaluator{context, &mask};
+  evaluator.add_with_destination(Field<int>(add_field), result_x);
+  evaluator.evaluate();
+  for (const int i : result.index_range()) {
+    EXPECT_EQ(result[i].x, i % 3 != 0 ? i * 2 : -1);
+    EXPECT_EQ(result[i].y, -1);
+  }
+}
+
 class TwoOutputFunction : public mf::MultiFunction {
  private:
   mf::Signature signature_;
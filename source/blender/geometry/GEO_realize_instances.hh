@@ -25,6 +25,11 @@ struct RealizeInstancesOptions {
    */
   bool realize_instance_attributes = true;
 
+  /**
+   * Attributes that are skipped by this filter are not realized at all. Since geometry components
+   * store attributes as concrete arrays, this is the main way to reduce the memory used by the
+   * output, e.g. by skipping anonymous attributes that are not used anymore.
+   */
   std::reference_wrapper<const bke::AttributeFilter> attribute_filter =
       bke::AttributeFilter::default_filter();
 };
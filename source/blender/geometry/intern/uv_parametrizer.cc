@@ -6,6 +6,7 @@
  * \ingroup eduv
  */
 
+#include <atomic>
 #include <functional>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 
 #ifdef WITH_UV_SLIM
 #  include "slim_matrix_transfer.h"
@@ -4072,49 +4074,64 @@ void uv_parametrizer_lscm_begin(ParamHandle *phandle, bool live, bool abf)
   BLI_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
   phandle->state = PHANDLE_STATE_LSCM;
 
-  for (int i = 0; i < phandle->ncharts; i++) {
-    for (PFace *f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
-    }
-    p_chart_lscm_begin(phandle->charts[i], live, abf);
-  }
+  /* Charts don't share any data and each gets its own solver, ABF is solved per chart too. */
+  blender::threading::parallel_for(
+      blender::IndexRange(phandle->ncharts), 8, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          for (PFace *f = phandle->charts[i]->faces; f; f = f->nextlink) {
+            p_face_backup_uvs(f);
+          }
+          p_chart_lscm_begin(phandle->charts[i], live, abf);
+        }
+      });
 }
 
 void uv_parametrizer_lscm_solve(ParamHandle *phandle, int *count_changed, int *count_failed)
 {
   BLI_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (int i = 0; i < phandle->ncharts; i++) {
-    PChart *chart = phandle->charts[i];
+  std::atomic<int> changed_num = 0;
+  std::atomic<int> failed_num = 0;
 
-    if (!chart->context) {
-      continue;
-    }
-    const bool result = p_chart_lscm_solve(phandle, chart);
+  /* The charts are solved independently, they only read the settings of the handle. */
+  blender::threading::parallel_for(
+      blender::IndexRange(phandle->ncharts), 8, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          PChart *chart = phandle->charts[i];
 
-    if (result && !chart->has_pins) {
-      /* Every call to LSCM will eventually call uv_pack, so rotating here might be redundant. */
-      p_chart_rotate_minimum_area(chart);
-    }
-    else if (result && chart->single_pin) {
-      p_chart_rotate_fit_aabb(chart);
-      p_chart_lscm_transform_single_pin(chart);
-    }
+          if (!chart->context) {
+            continue;
+          }
+          const bool result = p_chart_lscm_solve(phandle, chart);
 
-    if (!result || !chart->has_pins) {
-      p_chart_lscm_end(chart);
-    }
+          if (result && !chart->has_pins) {
+            /* Every call to LSCM will eventually call uv_pack, so rotating here might be
+             * redundant. */
+            p_chart_rotate_minimum_area(chart);
+          }
+          else if (result && chart->single_pin) {
+            p_chart_rotate_fit_aabb(chart);
+            p_chart_lscm_transform_single_pin(chart);
+          }
 
-    if (result) {
-      if (count_changed != nullptr) {
-        *count_changed += 1;
-      }
-    }
-    else {
-      if (count_failed != nullptr) {
-        *count_failed += 1;
-      }
-    }
+          if (!result || !chart->has_pins) {
+            p_chart_lscm_end(chart);
+          }
+
+          if (result) {
+            changed_num++;
+          }
+          else {
+            failed_num++;
+          }
+        }
+      });
+
+  if (count_changed != nullptr) {
+    *count_changed += changed_num;
+  }
+  if (count_failed != nullptr) {
+    *count_failed += failed_num;
   }
 }
 
@@ -90,6 +90,9 @@ struct GPUPass {
     GPU_SHADER_FREE_SAFE(shader);
   }
 
+  /* NOTE: Visible materials don't need a higher priority, since engines only request the
+   * materials of objects they draw. Optimized passes only replace already working shaders, so
+   * they are compiled last. */
   CompilationPriority compilation_priority()
   {
     return is_optimization_pass ? CompilationPriority::Low : CompilationPriority::Medium;
@@ -207,6 +210,11 @@ uint64_t GPU_pass_compilation_timestamp(GPUPass *pass)
  * Internal shader cache: This prevent the shader recompilation / stall when
  * using undo/redo AND also allows for GPUPass reuse if the Shader code is the
  * same for 2 different Materials. Unused GPUPasses are free by Garbage collection.
+ *
+ * \note This cache only lives for the session. Persistent caches are implemented by the backends,
+ * since only they know what can be stored: the SPIR-V and pipeline caches of Vulkan, and the
+ * program binaries of OpenGL when compiling in subprocesses (see `gl_compilation_subprocess.cc`).
+ * Metal has no disk cache yet.
  * \{ */
 
 class GPUPassCache {
@@ -237,7 +237,11 @@ void VKCommandBuilder::groups_build_commands(VKRenderGraph &render_graph,
     IndexRange group_nodes = group_nodes_[group_index];
     Span<NodeHandle> group_node_handles = node_handles.slice(group_nodes);
 
-    /* Record group pre barriers. */
+    /* Record group pre barriers.
+     *
+     * NOTE: These are not merged into a single barrier command. The barriers of different nodes
+     * in a group can transition the same image more than once (e.g. per layer), and barriers
+     * inside one command are not ordered with respect to each other. */
     for (BarrierIndex barrier_index : group_pre_barriers_[group_index]) {
       BLI_assert_msg(!rendering_active,
                      "Pre group barriers must be executed outside a rendering scope.");
@@ -753,6 +753,15 @@ void VKPipelinePool::read_from_disk()
   /* Read cached binary. */
   fstream file(cache_file, std::ios::binary | std::ios::in | std::ios::ate);
   std::streamsize data_size = file.tellg();
+  if (data_size < std::streamsize(sizeof(VKPipelineCachePrefixHeader))) {
+    /* Truncated or empty file, for example when Blender was closed while writing the cache. */
+    CLOG_INFO(&LOG,
+              1,
+              "Pipeline cache on disk [%s] is ignored as it is incomplete. Cache will be "
+              "overwritten when exiting.",
+              cache_file.c_str());
+    return;
+  }
   file.seekg(0, std::ios::beg);
   void *buffer = MEM_mallocN(data_size, __func__);
   file.read(reinterpret_cast<char *>(buffer), data_size);
@@ -762,7 +771,9 @@ void VKPipelinePool::read_from_disk()
   VKPipelineCachePrefixHeader prefix;
   VKPipelineCachePrefixHeader &read_prefix = *static_cast<VKPipelineCachePrefixHeader *>(buffer);
   prefix.data_size = read_prefix.data_size;
-  if (memcmp(&read_prefix, &prefix, sizeof(VKPipelineCachePrefixHeader)) != 0) {
+  if (memcmp(&read_prefix, &prefix, sizeof(VKPipelineCachePrefixHeader)) != 0 ||
+      data_size - sizeof(VKPipelineCachePrefixHeader) < read_prefix.data_size)
+  {
     /* Headers are different, most likely the cache will not work and potentially crash the driver.
      * [https://medium.com/@zeuxcg/creating-a-robust-pipeline-cache-with-vulkan-961d09416cda]
      */
@@ -793,6 +804,9 @@ void VKPipelinePool::read_from_disk()
 void VKPipelinePool::write_to_disk()
 {
 #ifdef WITH_BUILDINFO
+  /* NOTE: Only the static pipeline cache is stored. Pipelines of non-static shaders (materials,
+   * compositor nodes) depend on the files that were opened during the session and would make the
+   * cache grow without bounds. */
   /* Don't write the pipeline cache when GPU debugging is enabled. When enabled we use different
    * shaders and compilation settings. Writing them to disk will clutter the pipeline cache. */
   if (bool(G.debug & G_DEBUG_GPU)) {
@@ -17,6 +17,10 @@ namespace blender::gpu {
  * Utility class to copy data from host to device and vise versa.
  *
  * This is a common as buffers on device are more performant than when located inside host memory.
+ *
+ * \note Copies are recorded in the render graph and submitted to the graphics queue. Using a
+ * dedicated transfer queue would require queue family ownership transfers for every uploaded
+ * resource and synchronization between the queues, which the render graph doesn't track.
  */
 class VKStagingBuffer {
  public:
@@ -2123,16 +2123,33 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
         const size_t out_offset = y * width;
         const uchar *in = in_buffer + in_offset * 4;
         float *out = out_buffer + out_offset * 4;
+        if (processor) {
+          /* Convert the whole row at once, applying the processor per pixel has a large
+           * overhead. */
+          for (int x = 0; x < width; x++) {
+            rgba_uchar_to_float(out + x * 4, in + x * 4);
+          }
+          const ocio::PackedImage img(out,
+                                      width,
+                                      1,
+                                      4,
+                                      ocio::BitDepth::BIT_DEPTH_F32,
+                                      sizeof(float),
+                                      4 * sizeof(float),
+                                      4 * sizeof(float) * width);
+          processor->apply(img);
+          if (use_premultiply) {
+            for (int x = 0; x < width; x++) {
+              mul_v3_fl(out + x * 4, out[x * 4 + 3]);
+            }
+          }
+          continue;
+        }
         for (int x = 0; x < width; x++, in += 4, out += 4) {
           /* Convert to scene linear and premultiply. */
           float pixel[4];
           rgba_uchar_to_float(pixel, in);
-          if (processor) {
-            processor->apply_rgb(pixel);
-          }
-          else {
-            srgb_to_linearrgb_v3_v3(pixel, pixel);
-          }
+          srgb_to_linearrgb_v3_v3(pixel, pixel);
           if (use_premultiply) {
             mul_v3_fl(pixel, pixel[3]);
           }
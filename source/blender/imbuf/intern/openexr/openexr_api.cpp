@@ -1239,6 +1239,12 @@ void IMB_exr_read_channels(void *handle)
       }
     }
 
+    /* Skip parts without any requested channel, reading them would still decompress all of
+     * their chunks. */
+    if (frameBuffer.begin() == frameBuffer.end()) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
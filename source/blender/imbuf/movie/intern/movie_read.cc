@@ -342,6 +342,10 @@ static int startffmpeg(MovieReader *anim)
   avcodec_parameters_to_context(pCodecCtx, video_stream->codecpar);
   pCodecCtx->workaround_bugs = FF_BUG_AUTODETECT;
 
+  /* NOTE: Only software decoders are used, multi-threaded when the codec supports it. Hardware
+   * decoders (VAAPI, NVDEC, VideoToolbox, D3D11VA) output frames in GPU memory, which would have
+   * to be transferred back for the color space conversion and the #ImBuf based caches, and that
+   * transfer removes most of the gain. Proxies are the supported way to play back heavy codecs. */
   if (pCodec->capabilities & AV_CODEC_CAP_OTHER_THREADS) {
     pCodecCtx->thread_count = 0;
   }
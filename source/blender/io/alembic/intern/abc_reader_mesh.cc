@@ -632,6 +632,12 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
     return false;
   }
 
+  return sample_topology_changed(existing_mesh, sample);
+}
+
+bool AbcMeshReader::sample_topology_changed(const Mesh *existing_mesh,
+                                            const IPolyMeshSchema::Sample &sample) const
+{
   const P3fArraySamplePtr &positions = sample.getPositions();
   const Alembic::Abc::Int32ArraySamplePtr &face_indices = sample.getFaceIndices();
   const Alembic::Abc::Int32ArraySamplePtr &face_counts = sample.getFaceCounts();
@@ -748,7 +754,8 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   settings.velocity_name = velocity_name;
   settings.velocity_scale = velocity_scale;
 
-  if (topology_changed(existing_mesh, sample_sel)) {
+  /* Reuse the sample read above, reading it again would read all its arrays again. */
+  if (sample_topology_changed(existing_mesh, sample)) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, face_counts->size(), face_indices->size());
 
@@ -0,0 +1,80 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include <fmt/format.h>
+
+#include "BLI_fileops.h"
+#include "BLI_path_utils.hh"
+#include "BLI_tempfile.h"
+
+#include "BKE_attribute.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_pointcloud.hh"
+
+#include "DNA_pointcloud_types.h"
+
+#include "IO_csv.hh"
+
+namespace blender::io::csv::tests {
+
+class CSVImportTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+};
+
+TEST_F(CSVImportTest, IntegerChunksInFloatColumn)
+{
+  char temp_dir[FILE_MAX];
+  BLI_temp_directory_path_get(temp_dir, sizeof(temp_dir));
+  CSVImportParams params{};
+  BLI_path_join(params.filepath, sizeof(params.filepath), temp_dir, "blender_csv_test.csv");
+  params.delimiter = ',';
+
+  /* Enough rows to be parsed in multiple chunks. Only the last row contains a float, so all
+   * earlier chunks of the `a` column are parsed as integers and have to be converted. */
+  constexpr int rows_num = 50000;
+  fmt::memory_buffer buf;
+  fmt::format_to(fmt::appender(buf), "a,b\n");
+  for (const int i : IndexRange(rows_num - 1)) {
+    fmt::format_to(fmt::appender(buf), "{},{}\n", i, i);
+  }
+  fmt::format_to(fmt::appender(buf), "0.5,{}\n", rows_num - 1);
+
+  FILE *fp = BLI_fopen(params.filepath, "wb");
+  ASSERT_NE(fp, nullptr);
+  fwrite(buf.data(), 1, buf.size(), fp);
+  fclose(fp);
+
+  PointCloud *pointcloud = import_csv_as_pointcloud(params);
+  BLI_delete(params.filepath, false, false);
+  ASSERT_NE(pointcloud, nullptr);
+  ASSERT_EQ(pointcloud->totpoint, rows_num);
+
+  const bke::AttributeAccessor attributes = pointcloud->attributes();
+  const bke::GAttributeReader a = attributes.lookup("a");
+  const bke::GAttributeReader b = attributes.lookup("b");
+  ASSERT_TRUE(a);
+  ASSERT_TRUE(b);
+  EXPECT_TRUE(a.varray.type().is<float>());
+  EXPECT_TRUE(b.varray.type().is<int>());
+
+  const VArraySpan<float> a_values = a.varray.typed<float>();
+  const VArraySpan<int> b_values = b.varray.typed<int>();
+  for (const int i : IndexRange(rows_num - 1)) {
+    EXPECT_EQ(a_values[i], float(i));
+    EXPECT_EQ(b_values[i], i);
+  }
+  EXPECT_EQ(a_values.last(), 0.5f);
+  EXPECT_EQ(b_values.last(), rows_num - 1);
+
+  BKE_id_free(nullptr, pointcloud);
+}
+
+}  // namespace blender::io::csv::tests
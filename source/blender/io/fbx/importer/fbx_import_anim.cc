@@ -22,6 +22,7 @@
 #include "BLI_math_quaternion.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
@@ -344,48 +345,52 @@ static void create_transform_curve_data(const FbxElementMapping &mapping,
     BKE_fcurve_bezt_resize(curves[i], sorted_key_times.size());
   }
 
-  /* Evaluate transforms at all the key times. */
-  for (int64_t i = 0; i < sorted_key_times.size(); i++) {
-    double t = sorted_key_times[i];
-    float tf = float(t * fps + anim_offset);
-    ufbx_transform xform = ufbx_evaluate_transform(fbx_anim, fnode, t);
+  /* Evaluate transforms at all the key times. Evaluation in ufbx is thread safe, and every key
+   * only writes its own #BezTriple in each curve, so this can be done in parallel. */
+  threading::parallel_for(sorted_key_times.index_range(), 256, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      double t = sorted_key_times[i];
+      float tf = float(t * fps + anim_offset);
+      ufbx_transform xform = ufbx_evaluate_transform(fbx_anim, fnode, t);
+
+      if (is_bone) {
+        ufbx_matrix matrix = calc_bone_pose_matrix(xform, *fnode, bone_xform);
+        xform = ufbx_matrix_to_transform(&matrix);
+      }
 
-    if (is_bone) {
-      ufbx_matrix matrix = calc_bone_pose_matrix(xform, *fnode, bone_xform);
-      xform = ufbx_matrix_to_transform(&matrix);
-    }
+      set_curve_sample(curves[pos_index + 0], i, tf, float(xform.translation.x));
+      set_curve_sample(curves[pos_index + 1], i, tf, float(xform.translation.y));
+      set_curve_sample(curves[pos_index + 2], i, tf, float(xform.translation.z));
+
+      math::Quaternion quat(
+          xform.rotation.w, xform.rotation.x, xform.rotation.y, xform.rotation.z);
+      switch (rot_mode) {
+        case ROT_MODE_QUAT:
+          set_curve_sample(curves[rot_index + 0], i, tf, quat.w);
+          set_curve_sample(curves[rot_index + 1], i, tf, quat.x);
+          set_curve_sample(curves[rot_index + 2], i, tf, quat.y);
+          set_curve_sample(curves[rot_index + 3], i, tf, quat.z);
+          break;
+        case ROT_MODE_AXISANGLE: {
+          const math::AxisAngle axis_angle = math::to_axis_angle(quat);
+          set_curve_sample(curves[rot_index + 0], i, tf, axis_angle.angle().radian());
+          set_curve_sample(curves[rot_index + 1], i, tf, axis_angle.axis().x);
+          set_curve_sample(curves[rot_index + 2], i, tf, axis_angle.axis().y);
+          set_curve_sample(curves[rot_index + 3], i, tf, axis_angle.axis().z);
+        } break;
+        default: {
+          math::EulerXYZ euler = math::to_euler(quat);
+          set_curve_sample(curves[rot_index + 0], i, tf, euler.x().radian());
+          set_curve_sample(curves[rot_index + 1], i, tf, euler.y().radian());
+          set_curve_sample(curves[rot_index + 2], i, tf, euler.z().radian());
+        } break;
+      }
 
-    set_curve_sample(curves[pos_index + 0], i, tf, float(xform.translation.x));
-    set_curve_sample(curves[pos_index + 1], i, tf, float(xform.translation.y));
-    set_curve_sample(curves[pos_index + 2], i, tf, float(xform.translation.z));
-
-    math::Quaternion quat(xform.rotation.w, xform.rotation.x, xform.rotation.y, xform.rotation.z);
-    switch (rot_mode) {
-      case ROT_MODE_QUAT:
-        set_curve_sample(curves[rot_index + 0], i, tf, quat.w);
-        set_curve_sample(curves[rot_index + 1], i, tf, quat.x);
-        set_curve_sample(curves[rot_index + 2], i, tf, quat.y);
-        set_curve_sample(curves[rot_index + 3], i, tf, quat.z);
-        break;
-      case ROT_MODE_AXISANGLE: {
-        const math::AxisAngle axis_angle = math::to_axis_angle(quat);
-        set_curve_sample(curves[rot_index + 0], i, tf, axis_angle.angle().radian());
-        set_curve_sample(curves[rot_index + 1], i, tf, axis_angle.axis().x);
-        set_curve_sample(curves[rot_index + 2], i, tf, axis_angle.axis().y);
-        set_curve_sample(curves[rot_index + 3], i, tf, axis_angle.axis().z);
-      } break;
-      default: {
-        math::EulerXYZ euler = math::to_euler(quat);
-        set_curve_sample(curves[rot_index + 0], i, tf, euler.x().radian());
-        set_curve_sample(curves[rot_index + 1], i, tf, euler.y().radian());
-        set_curve_sample(curves[rot_index + 2], i, tf, euler.z().radian());
-      } break;
+      set_curve_sample(curves[scale_index + 0], i, tf, float(xform.scale.x));
+      set_curve_sample(curves[scale_index + 1], i, tf, float(xform.scale.y));
+      set_curve_sample(curves[scale_index + 2], i, tf, float(xform.scale.z));
     }
-
-    set_curve_sample(curves[scale_index + 0], i, tf, float(xform.scale.x));
-    set_curve_sample(curves[scale_index + 1], i, tf, float(xform.scale.y));
-    set_curve_sample(curves[scale_index + 2], i, tf, float(xform.scale.z));
-  }
+  });
 }
 
 static void create_camera_curves(const ufbx_metadata &metadata,
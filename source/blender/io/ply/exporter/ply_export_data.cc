@@ -10,54 +10,97 @@
 #include "ply_data.hh"
 #include "ply_file_buffer.hh"
 
+#include "BLI_array.hh"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 
 namespace blender::io::ply {
 
+/* Items are formatted in parallel in chunks of this size, see #parallel_chunked_output. */
+static const int chunk_size = 32768;
+
+/**
+ * Write \a tot_count independent items with \a function. When there is more than one chunk of
+ * items, the chunks are formatted in parallel into temporary memory buffers, which are then
+ * appended to \a buffer in order.
+ */
+template<typename Function>
+static void parallel_chunked_output(FileBuffer &buffer,
+                                    const int tot_count,
+                                    const Function &function)
+{
+  const int chunk_count = (tot_count + chunk_size - 1) / chunk_size;
+  if (chunk_count <= 1) {
+    for (int i = 0; i < tot_count; i++) {
+      function(buffer, i);
+    }
+    return;
+  }
+  Array<std::unique_ptr<FileBuffer>> buffers(chunk_count);
+  threading::parallel_for(IndexRange(chunk_count), 1, [&](const IndexRange range) {
+    for (const int r : range) {
+      buffers[r] = buffer.create_memory_buffer();
+      const int i_end = std::min((r + 1) * chunk_size, tot_count);
+      for (int i = r * chunk_size; i < i_end; i++) {
+        function(*buffers[r], i);
+      }
+    }
+  });
+  for (std::unique_ptr<FileBuffer> &chunk_buffer : buffers) {
+    buffer.append_from(*chunk_buffer);
+  }
+}
+
 void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
 {
-  for (int i = 0; i < ply_data.vertices.size(); i++) {
-    buffer.write_vertex(ply_data.vertices[i].x, ply_data.vertices[i].y, ply_data.vertices[i].z);
+  parallel_chunked_output(buffer, ply_data.vertices.size(), [&](FileBuffer &buf, const int i) {
+    buf.write_vertex(ply_data.vertices[i].x, ply_data.vertices[i].y, ply_data.vertices[i].z);
 
     if (!ply_data.vertex_normals.is_empty()) {
-      buffer.write_vertex_normal(ply_data.vertex_normals[i].x,
-                                 ply_data.vertex_normals[i].y,
-                                 ply_data.vertex_normals[i].z);
+      buf.write_vertex_normal(ply_data.vertex_normals[i].x,
+                              ply_data.vertex_normals[i].y,
+                              ply_data.vertex_normals[i].z);
     }
 
     if (!ply_data.vertex_colors.is_empty()) {
       /* PLY colors currently are exported as bytes, make sure inputs are clamped. */
       float4 color = math::clamp(ply_data.vertex_colors[i], 0.0f, 1.0f) * 255.0f;
-      buffer.write_vertex_color(uchar(color.x), uchar(color.y), uchar(color.z), uchar(color.w));
+      buf.write_vertex_color(uchar(color.x), uchar(color.y), uchar(color.z), uchar(color.w));
     }
 
     if (!ply_data.uv_coordinates.is_empty()) {
-      buffer.write_UV(ply_data.uv_coordinates[i].x, ply_data.uv_coordinates[i].y);
+      buf.write_UV(ply_data.uv_coordinates[i].x, ply_data.uv_coordinates[i].y);
     }
 
     for (const PlyCustomAttribute &attr : ply_data.vertex_custom_attr) {
-      buffer.write_data(attr.data[i]);
+      buf.write_data(attr.data[i]);
     }
 
-    buffer.write_vertex_end();
-  }
+    buf.write_vertex_end();
+  });
   buffer.write_to_file();
 }
 
 void write_faces(FileBuffer &buffer, const PlyData &ply_data)
 {
-  const uint32_t *indices = ply_data.face_vertices.data();
-  for (uint32_t face_size : ply_data.face_sizes) {
-    buffer.write_face(char(face_size), Span<uint32_t>(indices, face_size));
-    indices += face_size;
+  /* Offsets of the face vertex indices, so that faces can be written independently. */
+  Array<int64_t> face_offsets(ply_data.face_sizes.size() + 1);
+  face_offsets[0] = 0;
+  for (const int64_t i : ply_data.face_sizes.index_range()) {
+    face_offsets[i + 1] = face_offsets[i] + ply_data.face_sizes[i];
   }
+  const uint32_t *indices = ply_data.face_vertices.data();
+  parallel_chunked_output(buffer, ply_data.face_sizes.size(), [&](FileBuffer &buf, const int i) {
+    const uint32_t face_size = ply_data.face_sizes[i];
+    buf.write_face(char(face_size), Span<uint32_t>(indices + face_offsets[i], face_size));
+  });
   buffer.write_to_file();
 }
 void write_edges(FileBuffer &buffer, const PlyData &ply_data)
 {
-  for (const std::pair<int, int> &edge : ply_data.edges) {
-    buffer.write_edge(edge.first, edge.second);
-  }
+  parallel_chunked_output(buffer, ply_data.edges.size(), [&](FileBuffer &buf, const int i) {
+    buf.write_edge(ply_data.edges[i].first, ply_data.edges[i].second);
+  });
   buffer.write_to_file();
 }
 }  // namespace blender::io::ply
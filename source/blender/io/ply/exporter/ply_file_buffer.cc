@@ -27,6 +27,11 @@ FileBuffer::FileBuffer(const char *filepath, size_t buffer_chunk_size)
   }
 }
 
+FileBuffer::FileBuffer(size_t buffer_chunk_size)
+    : buffer_chunk_size_(buffer_chunk_size), filepath_(nullptr), outfile_(nullptr)
+{
+}
+
 void FileBuffer::write_to_file()
 {
   for (const VectorChar &b : blocks_) {
@@ -35,6 +40,14 @@ void FileBuffer::write_to_file()
   blocks_.clear();
 }
 
+void FileBuffer::append_from(FileBuffer &other)
+{
+  for (VectorChar &block : other.blocks_) {
+    blocks_.append(std::move(block));
+  }
+  other.blocks_.clear();
+}
+
 void FileBuffer::close_file()
 {
   if (!outfile_) {
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "BLI_string_ref.hh"
 #include "BLI_utility_mixins.hh"
 #include "BLI_vector.hh"
@@ -35,6 +37,9 @@ class FileBuffer : private NonMovable {
  public:
   FileBuffer(const char *filepath, size_t buffer_chunk_size = 64 * 1024);
 
+  /** Buffer that is not backed by a file, its contents are moved with #append_from. */
+  explicit FileBuffer(size_t buffer_chunk_size);
+
   virtual ~FileBuffer() = default;
 
   /* Write contents to the buffer(s) into a file, and clear the buffers. */
@@ -42,6 +47,13 @@ class FileBuffer : private NonMovable {
 
   void close_file();
 
+  /* Create a buffer of the same format without a file, to format parts of the output in
+   * parallel. */
+  virtual std::unique_ptr<FileBuffer> create_memory_buffer() const = 0;
+
+  /* Move the contents of another buffer to the end of this one. */
+  void append_from(FileBuffer &other);
+
   virtual void write_vertex(float x, float y, float z) = 0;
 
   virtual void write_UV(float u, float v) = 0;
@@ -69,6 +81,11 @@ class FileBuffer : private NonMovable {
   void write_newline();
 
  protected:
+  size_t buffer_chunk_size() const
+  {
+    return buffer_chunk_size_;
+  }
+
   /* Ensure the last block contains at least this amount of free space.
    * If not, add a new block with max of block size & the amount of space needed. */
   void ensure_space(size_t at_least)
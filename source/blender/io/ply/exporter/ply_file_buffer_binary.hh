@@ -15,6 +15,11 @@ class FileBufferBinary : public FileBuffer {
   using FileBuffer::FileBuffer;
 
  public:
+  std::unique_ptr<FileBuffer> create_memory_buffer() const override
+  {
+    return std::make_unique<FileBufferBinary>(this->buffer_chunk_size());
+  }
+
   void write_vertex(float x, float y, float z) override;
 
   void write_UV(float u, float v) override;
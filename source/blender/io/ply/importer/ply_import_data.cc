@@ -15,6 +15,7 @@
 
 #include "fast_float.h"
 
+#include <algorithm>
 #include <charconv>
 
 #include "CLG_log.h"
@@ -193,22 +194,45 @@ template<typename T> static T get_binary_value(PlyDataTypes type, const uint8_t
   return val;
 }
 
+/* Binary rows are read from the file in chunks, instead of one read per row. */
+static constexpr int binary_rows_chunk_size = 4096;
+
+/**
+ * Make sure the binary row at \a index is in \a r_scratch, reading the next chunk of rows from
+ * the file when needed. Returns the row, or null if it could not be read.
+ */
+static uint8_t *read_row_binary(PlyReadBuffer &file,
+                                const PlyElement &element,
+                                const int index,
+                                Vector<uint8_t> &r_scratch)
+{
+  const int index_in_chunk = index % binary_rows_chunk_size;
+  if (index_in_chunk == 0) {
+    const int rows = std::min(binary_rows_chunk_size, element.count - index);
+    r_scratch.resize(int64_t(rows) * element.stride);
+    if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
+      return nullptr;
+    }
+  }
+  return r_scratch.data() + int64_t(index_in_chunk) * element.stride;
+}
+
 static const char *parse_row_binary(PlyReadBuffer &file,
                                     const PlyHeader &header,
                                     const PlyElement &element,
+                                    const int index,
                                     Vector<uint8_t> &r_scratch,
                                     Vector<float> &r_values)
 {
   if (element.stride == 0) {
     return "Vertex/Edge element contains list properties, this is not supported";
   }
-  BLI_assert(r_scratch.size() == element.stride);
   BLI_assert(r_values.size() == element.properties.size());
-  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
+  const uint8_t *ptr = read_row_binary(file, element, index, r_scratch);
+  if (ptr == nullptr) {
     return "Could not read row of binary property";
   }
 
-  const uint8_t *ptr = r_scratch.data();
   if (header.type == PlyFormatType::BINARY_LE) {
     /* Little endian: just read/convert the values. */
     for (int i = 0, n = int(element.properties.size()); i != n; i++) {
@@ -293,9 +317,6 @@ static const char *load_vertex_element(PlyReadBuffer &file,
 
   Vector<float> value_vec(element.properties.size());
   Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
 
   for (int i = 0; i < element.count; i++) {
 
@@ -304,7 +325,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       error = parse_row_ascii(file, value_vec);
     }
     else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
+      error = parse_row_binary(file, header, element, i, scratch, value_vec);
     }
     if (error != nullptr) {
       return error;
@@ -598,9 +619,6 @@ static const char *load_edge_element(PlyReadBuffer &file,
 
   Vector<float> value_vec(element.properties.size());
   Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
 
   for (int i = 0; i < element.count; i++) {
     const char *error = nullptr;
@@ -608,7 +626,7 @@ static const char *load_edge_element(PlyReadBuffer &file,
       error = parse_row_ascii(file, value_vec);
     }
     else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
+      error = parse_row_binary(file, header, element, i, scratch, value_vec);
     }
     if (error != nullptr) {
       return error;
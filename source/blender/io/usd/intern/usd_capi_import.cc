@@ -270,7 +270,12 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
-  /* Setup parenthood and read actual object data. */
+  /* Setup parenthood and read actual object data.
+   *
+   * NOTE: This is done serially. Readers mix reading USD attributes with changes to #Main, such
+   * as assigning materials and adding modifiers, which are not thread safe. Reading prims in
+   * parallel requires splitting each reader into a pass that only reads USD data into
+   * nomain geometry, followed by a serial pass that adds it to #Main. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
     if (!reader) {
@@ -16,6 +16,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DNA_collection_types.h"
 #include "DNA_node_types.h"
@@ -81,10 +82,9 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
     scales_attribute.span.fill(float3(1.0f));
   }
 
-  Span<pxr::GfVec3f> scales = Span(usd_scales.cdata(), usd_scales.size());
-  for (const int i : IndexRange(std::min(usd_scales.size(), usd_positions.size()))) {
-    scales_attribute.span[i] = float3(scales[i][0], scales[i][1], scales[i][2]);
-  }
+  Span<float3> scales = Span(usd_scales.cdata(), usd_scales.size()).cast<float3>();
+  const int64_t scales_num = std::min(usd_scales.size(), usd_positions.size());
+  scales_attribute.span.take_front(scales_num).copy_from(scales.take_front(scales_num));
 
   scales_attribute.finish();
 
@@ -97,12 +97,17 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
   }
 
   Span<pxr::GfQuath> orientations = Span(usd_orientations.cdata(), usd_orientations.size());
-  for (const int i : IndexRange(std::min(usd_orientations.size(), usd_positions.size()))) {
-    orientations_attribute.span[i] = math::Quaternion(orientations[i].GetReal(),
-                                                      orientations[i].GetImaginary()[0],
-                                                      orientations[i].GetImaginary()[1],
-                                                      orientations[i].GetImaginary()[2]);
-  }
+  threading::parallel_for(
+      IndexRange(std::min(usd_orientations.size(), usd_positions.size())),
+      4096,
+      [&](const IndexRange range) {
+        for (const int i : range) {
+          orientations_attribute.span[i] = math::Quaternion(orientations[i].GetReal(),
+                                                            orientations[i].GetImaginary()[0],
+                                                            orientations[i].GetImaginary()[1],
+                                                            orientations[i].GetImaginary()[2]);
+        }
+      });
 
   orientations_attribute.finish();
 
@@ -114,9 +119,9 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
   }
 
   Span<int> proto_indices = Span(usd_proto_indices.cdata(), usd_proto_indices.size());
-  for (const int i : IndexRange(std::min(usd_proto_indices.size(), usd_positions.size()))) {
-    proto_indices_attribute.span[i] = proto_indices[i];
-  }
+  const int64_t proto_indices_num = std::min(usd_proto_indices.size(), usd_positions.size());
+  proto_indices_attribute.span.take_front(proto_indices_num).copy_from(
+      proto_indices.take_front(proto_indices_num));
 
   proto_indices_attribute.finish();
 
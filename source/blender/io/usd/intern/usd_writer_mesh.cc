@@ -18,6 +18,7 @@
 #include "BLI_array_utils.hh"
 #include "BLI_assert.h"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 
 #include "BKE_anonymous_attribute_id.hh"
 #include "BKE_attribute.hh"
@@ -664,9 +665,11 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh &usd
     case bke::MeshNormalDomain::Face: {
       const OffsetIndices faces = mesh->faces();
       const Span<float3> face_normals = mesh->face_normals();
-      for (const int i : faces.index_range()) {
-        dst_normals.slice(faces[i]).fill(face_normals[i]);
-      }
+      threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          dst_normals.slice(faces[i]).fill(face_normals[i]);
+        }
+      });
       break;
     }
     case bke::MeshNormalDomain::Corner: {
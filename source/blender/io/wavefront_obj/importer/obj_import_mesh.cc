@@ -70,12 +70,11 @@ Mesh *MeshFromGeometry::create_mesh(const OBJImportParams &import_params)
 
 Object *MeshFromGeometry::create_mesh_object(
     Main *bmain,
+    Mesh *mesh,
     Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
     Map<std::string, Material *> &created_materials,
     const OBJImportParams &import_params)
 {
-  Mesh *mesh = this->create_mesh(import_params);
-
   if (mesh == nullptr) {
     return nullptr;
   }
@@ -36,9 +36,17 @@ class MeshFromGeometry : NonMovable, NonCopyable {
   {
   }
 
+  /**
+   * Only creates the mesh data without adding anything to #Main, so it can be called for many
+   * geometries in parallel.
+   */
   Mesh *create_mesh(const OBJImportParams &import_params);
 
+  /**
+   * Add an object using the mesh created by #create_mesh, taking ownership of it.
+   */
   Object *create_mesh_object(Main *bmain,
+                             Mesh *mesh,
                              Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
                              Map<std::string, Material *> &created_materials,
                              const OBJImportParams &import_params);
@@ -8,12 +8,14 @@
 
 #include <string>
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_set.hh"
 #include "BLI_sort.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
 #include "BKE_context.hh"
 #include "BKE_curve_legacy_convert.hh"
@@ -81,13 +83,23 @@ static void geometry_to_blender_geometry_set(const OBJImportParams &import_param
                                              const GlobalVertices &global_vertices,
                                              Vector<bke::GeometrySet> &geometries)
 {
-  for (const std::unique_ptr<Geometry> &geometry : all_geometries) {
+  /* Mesh creation doesn't touch #Main, so all meshes can be created in parallel. */
+  Array<Mesh *> meshes(all_geometries.size(), nullptr);
+  threading::parallel_for(all_geometries.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (all_geometries[i]->geom_type_ == GEOM_MESH) {
+        MeshFromGeometry mesh_ob_from_geometry{*all_geometries[i], global_vertices};
+        meshes[i] = mesh_ob_from_geometry.create_mesh(import_params);
+      }
+    }
+  });
+
+  for (const int64_t i : all_geometries.index_range()) {
+    const std::unique_ptr<Geometry> &geometry = all_geometries[i];
     bke::GeometrySet geometry_set;
 
     if (geometry->geom_type_ == GEOM_MESH) {
-      MeshFromGeometry mesh_ob_from_geometry{*geometry, global_vertices};
-      Mesh *mesh = mesh_ob_from_geometry.create_mesh(import_params);
-      geometry_set = bke::GeometrySet::from_mesh(mesh);
+      geometry_set = bke::GeometrySet::from_mesh(meshes[i]);
     }
     else if (geometry->geom_type_ == GEOM_CURVE) {
       CurveFromGeometry curve_ob_from_geometry(*geometry, global_vertices);
@@ -124,16 +136,29 @@ static void geometry_to_blender_objects(Main *bmain,
         return BLI_strcasecmp(na, nb) < 0;
       });
 
+  /* Creating the mesh data is the most expensive part and doesn't touch #Main, so do it in
+   * parallel. Adding the objects and materials to #Main has to stay single threaded. */
+  Array<Mesh *> meshes(all_geometries.size(), nullptr);
+  threading::parallel_for(all_geometries.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (all_geometries[i]->geom_type_ == GEOM_MESH) {
+        MeshFromGeometry mesh_ob_from_geometry{*all_geometries[i], global_vertices};
+        meshes[i] = mesh_ob_from_geometry.create_mesh(import_params);
+      }
+    }
+  });
+
   /* Create all the objects. */
   Vector<Object *> objects;
   objects.reserve(all_geometries.size());
   Set<Collection *> collections;
-  for (const std::unique_ptr<Geometry> &geometry : all_geometries) {
+  for (const int64_t i : all_geometries.index_range()) {
+    const std::unique_ptr<Geometry> &geometry = all_geometries[i];
     Object *obj = nullptr;
     if (geometry->geom_type_ == GEOM_MESH) {
       MeshFromGeometry mesh_ob_from_geometry{*geometry, global_vertices};
       obj = mesh_ob_from_geometry.create_mesh_object(
-          bmain, materials, created_materials, import_params);
+          bmain, meshes[i], materials, created_materials, import_params);
     }
     else if (geometry->geom_type_ == GEOM_CURVE) {
       CurveFromGeometry curve_ob_from_geometry(*geometry, global_vertices);
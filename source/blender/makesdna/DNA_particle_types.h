@@ -353,7 +353,7 @@ typedef struct ParticleSystem {
 
   /** Used for instancing. */
   float imat[4][4];
-  float cfra, tree_frame, bvhtree_frame;
+  float cfra, tree_frame;
   int seed, child_seed;
   int flag, totpart, totunexist, totchild, totcached, totchildcache;
   /* NOTE: Recalc is one of ID_RECALC_PSYS_ALL flags.
@@ -361,7 +361,7 @@ typedef struct ParticleSystem {
    * TODO(sergey): Use #ParticleSettings.id.recalc instead of this duplicated flag somehow. */
   int recalc;
   short target_psys, totkeyed, bakespace;
-  char _pad1[6];
+  char _pad1[2];
 
   /** Billboard UV name. */
   char bb_uvname[3][/*MAX_CUSTOMDATA_LAYER_NAME*/ 68] DNA_DEPRECATED;
@@ -383,8 +383,6 @@ typedef struct ParticleSystem {
 
   /** Used for interactions with self and other systems. */
   struct KDTree_3d *tree;
-  /** Used for interactions with self and other systems. */
-  struct BVHTree *bvhtree;
 
   struct ParticleDrawData *pdd;
 
@@ -2626,6 +2626,8 @@ enum {
   SCE_KEYS_NO_SELONLY = 1 << 4,
   SCE_READFILE_LIBLINK_NEED_SETSCENE_CHECK = 1 << 5,
   SCE_CUSTOM_SIMULATION_RANGE = 1 << 6,
+  /** Frames can be evaluated independently from each other, on separate dependency graphs. */
+  SCE_PARALLEL_FRAME_EVALUATION = 1 << 7,
 };
 
 /* Return flag BKE_scene_base_iter_next functions. */
@@ -787,6 +787,12 @@ PropertyRNA *RNA_struct_find_property(PointerRNA *ptr, const char *identifier)
   else {
     /* most common case */
     PropertyRNA *iterprop = RNA_struct_iterator_property(ptr->type);
+    const CollectionPropertyRNA *cprop = (CollectionPropertyRNA *)rna_ensure_property(iterprop);
+    if (cprop->lookupstring == rna_builtin_properties_lookup_string) {
+      /* Avoid creating the pointers for the property collection. */
+      return rna_builtin_properties_find(ptr->type, identifier);
+    }
+
     PointerRNA propptr;
 
     if (RNA_property_collection_lookup_string(ptr, iterprop, identifier, &propptr)) {
@@ -4931,6 +4937,118 @@ static int rna_property_array_length_all_dimensions(PointerRNA *ptr, PropertyRNA
   return size;
 }
 
+/**
+ * Copy a raw array into a buffer of a different type, converting every element the same way as
+ * the per-item fallback does. This avoids iterating over the collection through RNA, which is
+ * common when Python passes buffers with a different type, e.g. `float64` NumPy arrays.
+ */
+template<typename T>
+static void rna_raw_access_convert_get_typed(const RawArray &in,
+                                             const RawArray &out,
+                                             const int item_len)
+{
+  int a = 0;
+  for (int i = 0; i < out.len; i++) {
+    const T *out_item = reinterpret_cast<const T *>(static_cast<const char *>(out.array) +
+                                                    size_t(i) * out.stride);
+    for (int j = 0; j < item_len; j++, a++) {
+      RAW_SET(T, in, a, out_item[j]);
+    }
+  }
+}
+
+/**
+ * Copy a buffer of a different type into a raw array of floating point values, clamping them to
+ * the hard range of the property like #RNA_property_float_set does.
+ */
+template<typename T>
+static void rna_raw_access_convert_set_typed(const RawArray &in,
+                                             const RawArray &out,
+                                             const int item_len,
+                                             const double hardmin,
+                                             const double hardmax)
+{
+  int a = 0;
+  for (int i = 0; i < out.len; i++) {
+    T *out_item = reinterpret_cast<T *>(static_cast<char *>(out.array) + size_t(i) * out.stride);
+    for (int j = 0; j < item_len; j++, a++) {
+      double value;
+      RAW_GET(double, value, in, a);
+      CLAMP(value, hardmin, hardmax);
+      out_item[j] = T(value);
+    }
+  }
+}
+
+static bool rna_raw_access_convert(const RawArray &in,
+                                   const RawArray &out,
+                                   PropertyRNA *itemprop,
+                                   const int item_len,
+                                   const bool set)
+{
+  if (set) {
+    /* Integer properties and properties with a dynamic range use the per-item fallback. Values
+     * that are out of range or not a number can't be converted to integers safely. */
+    if (RNA_property_type(itemprop) != PROP_FLOAT) {
+      return false;
+    }
+    const FloatPropertyRNA *fprop = reinterpret_cast<const FloatPropertyRNA *>(itemprop);
+    if (fprop->range || fprop->range_ex) {
+      return false;
+    }
+    switch (out.type) {
+      case PROP_RAW_FLOAT:
+        rna_raw_access_convert_set_typed<float>(in, out, item_len, fprop->hardmin, fprop->hardmax);
+        return true;
+      case PROP_RAW_DOUBLE:
+        rna_raw_access_convert_set_typed<double>(
+            in, out, item_len, fprop->hardmin, fprop->hardmax);
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  switch (out.type) {
+    case PROP_RAW_CHAR:
+      rna_raw_access_convert_get_typed<char>(in, out, item_len);
+      return true;
+    case PROP_RAW_INT8:
+      rna_raw_access_convert_get_typed<int8_t>(in, out, item_len);
+      return true;
+    case PROP_RAW_UINT8:
+      rna_raw_access_convert_get_typed<uint8_t>(in, out, item_len);
+      return true;
+    case PROP_RAW_SHORT:
+      rna_raw_access_convert_get_typed<short>(in, out, item_len);
+      return true;
+    case PROP_RAW_UINT16:
+      rna_raw_access_convert_get_typed<uint16_t>(in, out, item_len);
+      return true;
+    case PROP_RAW_INT:
+      rna_raw_access_convert_get_typed<int>(in, out, item_len);
+      return true;
+    case PROP_RAW_BOOLEAN:
+      rna_raw_access_convert_get_typed<bool>(in, out, item_len);
+      return true;
+    case PROP_RAW_FLOAT:
+      rna_raw_access_convert_get_typed<float>(in, out, item_len);
+      return true;
+    case PROP_RAW_DOUBLE:
+      rna_raw_access_convert_get_typed<double>(in, out, item_len);
+      return true;
+    case PROP_RAW_INT64:
+      rna_raw_access_convert_get_typed<int64_t>(in, out, item_len);
+      return true;
+    case PROP_RAW_UINT64:
+      rna_raw_access_convert_get_typed<uint64_t>(in, out, item_len);
+      return true;
+    case PROP_RAW_UNSET:
+      break;
+  }
+  return false;
+}
+
 static int rna_raw_access(ReportList *reports,
                           PointerRNA *ptr,
                           PropertyRNA *prop,
@@ -5029,8 +5147,9 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      if (rna_raw_access_convert(in, out, itemprop, item_len, set)) {
+        return 1;
+      }
     }
     BLI_assert_msg(array_len == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
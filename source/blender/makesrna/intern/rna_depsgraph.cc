@@ -280,6 +280,27 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_trace_begin(Depsgraph *depsgraph)
+{
+  DEG_debug_trace_begin(depsgraph);
+}
+
+static void rna_Depsgraph_debug_trace_end(Depsgraph *depsgraph,
+                                          ReportList *reports,
+                                          const char *filepath)
+{
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file '%s' for writing", filepath);
+    DEG_debug_trace_end(depsgraph, nullptr);
+    return;
+  }
+  if (!DEG_debug_trace_end(depsgraph, f)) {
+    BKE_report(reports, RPT_ERROR, "Trace recording was not started");
+  }
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -730,6 +751,18 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_trace_begin", "rna_Depsgraph_debug_trace_begin");
+  RNA_def_function_ui_description(
+      func, "Start recording the evaluation time and thread of every operation of the graph");
+
+  func = RNA_def_function(srna, "debug_trace_end", "rna_Depsgraph_debug_trace_end");
+  RNA_def_function_ui_description(
+      func, "Stop recording the evaluation trace, and save it in the Chrome trace event format");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
@@ -560,6 +560,8 @@ void rna_builtin_properties_next(CollectionPropertyIterator *iter);
 PointerRNA rna_builtin_properties_get(CollectionPropertyIterator *iter);
 PointerRNA rna_builtin_type_get(PointerRNA *ptr);
 bool rna_builtin_properties_lookup_string(PointerRNA *ptr, const char *key, PointerRNA *r_ptr);
+/** The property lookup of #rna_builtin_properties_lookup_string, without creating pointers. */
+PropertyRNA *rna_builtin_properties_find(StructRNA *srna, const char *key);
 
 /* Iterators */
 
@@ -571,33 +571,34 @@ PointerRNA rna_builtin_properties_get(CollectionPropertyIterator *iter)
   return rna_Struct_properties_get(iter);
 }
 
-bool rna_builtin_properties_lookup_string(PointerRNA *ptr, const char *key, PointerRNA *r_ptr)
+PropertyRNA *rna_builtin_properties_find(StructRNA *srna, const char *key)
 {
-  StructRNA *srna;
-  PropertyRNA *prop;
-
-  srna = ptr->type;
-
   do {
     if (srna->cont.prop_lookup_set) {
       PropertyRNA *const *lookup_prop = srna->cont.prop_lookup_set->lookup_key_ptr_as(key);
-      prop = lookup_prop ? *lookup_prop : nullptr;
-      if (prop) {
-        *r_ptr = {nullptr, &RNA_Property, prop};
-        return true;
+      if (lookup_prop) {
+        return *lookup_prop;
       }
     }
     else {
-      for (prop = static_cast<PropertyRNA *>(srna->cont.properties.first); prop; prop = prop->next)
-      {
+      LISTBASE_FOREACH (PropertyRNA *, prop, &srna->cont.properties) {
         if (!(prop->flag_internal & PROP_INTERN_BUILTIN) && STREQ(prop->identifier, key)) {
-          *r_ptr = {nullptr, &RNA_Property, prop};
-          return true;
+          return prop;
         }
       }
     }
   } while ((srna = srna->base));
 
+  return nullptr;
+}
+
+bool rna_builtin_properties_lookup_string(PointerRNA *ptr, const char *key, PointerRNA *r_ptr)
+{
+  if (PropertyRNA *prop = rna_builtin_properties_find(ptr->type, key)) {
+    *r_ptr = {nullptr, &RNA_Property, prop};
+    return true;
+  }
+
   *r_ptr = {};
   return false;
 }
@@ -9000,6 +9000,16 @@ void RNA_def_scene(BlenderRNA *brna)
   RNA_def_property_update(prop, NC_SCENE, nullptr);
 #  endif
 
+  prop = RNA_def_property(srna, "use_parallel_frame_evaluation", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", SCE_PARALLEL_FRAME_EVALUATION);
+  RNA_def_property_ui_text(
+      prop,
+      "Parallel Frame Evaluation",
+      "Allow tools which evaluate a range of frames, like motion path calculation, to evaluate "
+      "multiple frames at the same time on independent copies of the scene data. Only enable "
+      "when the state at a frame does not depend on previous frames or on frame change handlers");
+  RNA_def_property_clear_flag(prop, PROP_ANIMATABLE);
+
   prop = RNA_def_property(srna, "use_custom_simulation_range", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, nullptr, "flag", SCE_CUSTOM_SIMULATION_RANGE);
   RNA_def_property_ui_text(prop,
@@ -123,6 +123,12 @@ static void deform_verts(ModifierData *md,
   /* if next modifier needs original vertices */
   MOD_previous_vcos_store(md, reinterpret_cast<float(*)[3]>(positions.data()));
 
+  /* NOTE: Deformation always happens on the CPU. A GPU evaluated path would have to follow the
+   * GPU subdivision design: only when the modifier is last in the stack, store the evaluation
+   * settings in the mesh runtime instead of deforming, and let the draw cache deform the
+   * position VBO with weights kept on the GPU. Normals, bounds and anything reading the
+   * evaluated positions on the CPU (snapping, selection, physics) would then need to handle the
+   * deferred deformation. */
   BKE_armature_deform_coords_with_mesh(amd->object,
                                        ctx->object,
                                        reinterpret_cast<float(*)[3]>(positions.data()),
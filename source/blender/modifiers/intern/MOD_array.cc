@@ -15,8 +15,10 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math_matrix.h"
+#include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -385,7 +387,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
 
   using namespace blender;
 
-  int2 *edge;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
@@ -594,56 +595,62 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
         .copy_from(src_vert_normals);
   }
 
+  /* The offsets accumulate, so compute them up front to fill the copies in parallel. */
+  Array<float4x4> chunk_offsets(count);
+  chunk_offsets[0] = float4x4::identity();
   for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vert_data, &result->vert_data, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edge_data, &result->edge_data, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(
-        &mesh->corner_data, &result->corner_data, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->face_data, &result->face_data, 0, c * chunk_nfaces, chunk_nfaces);
-
-    /* recalculate cumulative offset here */
     mul_m4_m4m4(current_offset, current_offset, offset);
+    chunk_offsets[c] = float4x4(current_offset);
+  }
+
+  threading::parallel_for(IndexRange(1, count - 1), 16, [&](const IndexRange range) {
+    for (const int chunk : range) {
+      /* copy customdata to new geometry */
+      CustomData_copy_data(
+          &mesh->vert_data, &result->vert_data, 0, chunk * chunk_nverts, chunk_nverts);
+      CustomData_copy_data(
+          &mesh->edge_data, &result->edge_data, 0, chunk * chunk_nedges, chunk_nedges);
+      CustomData_copy_data(
+          &mesh->corner_data, &result->corner_data, 0, chunk * chunk_nloops, chunk_nloops);
+      CustomData_copy_data(
+          &mesh->face_data, &result->face_data, 0, chunk * chunk_nfaces, chunk_nfaces);
+
+      const float4x4 &chunk_offset = chunk_offsets[chunk];
 
-    if (chunk_nverts) {
       /* Apply offset to all new verts. */
-      const int vert_offset = c * chunk_nverts;
-      for (i = 0; i < chunk_nverts; i++) {
-        const int i_dst = vert_offset + i;
-        mul_m4_v3(current_offset, result_positions[i_dst]);
+      const int vert_offset = chunk * chunk_nverts;
+      for (const int vert : IndexRange(chunk_nverts)) {
+        const int i_dst = vert_offset + vert;
+        mul_m4_v3(chunk_offset.ptr(), result_positions[i_dst]);
 
         /* We have to correct normals too, if we do not tag them as dirty! */
         if (!dst_vert_normals.is_empty()) {
-          copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[i]);
-          mul_mat3_m4_v3(current_offset, dst_vert_normals[i_dst]);
+          copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[vert]);
+          mul_mat3_m4_v3(chunk_offset.ptr(), dst_vert_normals[i_dst]);
           normalize_v3(dst_vert_normals[i_dst]);
         }
       }
-    }
 
-    if (chunk_nedges) {
       /* Adjust edge vertex indices. */
-      edge = &result_edges[c * chunk_nedges];
-      for (i = 0; i < chunk_nedges; i++, edge++) {
-        (*edge) += c * chunk_nverts;
+      for (int2 &edge : result_edges.slice(chunk * chunk_nedges, chunk_nedges)) {
+        edge += chunk * chunk_nverts;
       }
-    }
 
-    if (chunk_nfaces) {
-      for (i = 0; i < chunk_nfaces; i++) {
-        result_face_offsets[c * chunk_nfaces + i] = result_face_offsets[i] + c * chunk_nloops;
+      for (const int face : IndexRange(chunk_nfaces)) {
+        result_face_offsets[chunk * chunk_nfaces + face] = result_face_offsets[face] +
+                                                           chunk * chunk_nloops;
       }
-    }
 
-    if (chunk_nloops) {
       /* Adjust loop vertex and edge indices. */
-      const int chunk_corner_start = c * chunk_nloops;
-      for (i = 0; i < chunk_nloops; i++) {
-        result_corner_verts[chunk_corner_start + i] += c * chunk_nverts;
-        result_corner_edges[chunk_corner_start + i] += c * chunk_nedges;
+      const int chunk_corner_start = chunk * chunk_nloops;
+      for (const int corner : IndexRange(chunk_corner_start, chunk_nloops)) {
+        result_corner_verts[corner] += chunk * chunk_nverts;
+        result_corner_edges[corner] += chunk * chunk_nedges;
       }
     }
+  });
 
+  for (c = 1; c < count; c++) {
     /* Handle merge between chunk n and n-1 */
     if (use_merge && (c >= 1)) {
       if (!offset_has_scale && (c >= 2)) {
@@ -15,6 +15,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_multi_value_map.hh"
+#include "BLI_profile.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
@@ -1813,6 +1814,7 @@ static void modifyGeometry(ModifierData *md,
                            bke::GeometrySet &geometry_set)
 {
   using namespace blender;
+  BLI_PROFILE_SCOPE("Geometry Nodes Modifier");
   NodesModifierData *nmd = reinterpret_cast<NodesModifierData *>(md);
   if (nmd->node_group == nullptr) {
     return;
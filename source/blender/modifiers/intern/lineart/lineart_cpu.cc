@@ -391,6 +391,10 @@ static void lineart_occlusion_single_line(LineartData *ld, LineartEdge *e, int t
 {
   LineartTriangleThread *tri;
   double l, r;
+  const double *fb1 = e->v1->fbcoord, *fb2 = e->v2->fbcoord;
+  const double e_min_x = std::min(fb1[0], fb2[0]), e_max_x = std::max(fb1[0], fb2[0]);
+  const double e_min_y = std::min(fb1[1], fb2[1]), e_max_y = std::max(fb1[1], fb2[1]);
+  const double e_max_depth = std::max(fb1[3], fb2[3]);
   LRT_EDGE_BA_MARCHING_BEGIN(e->v1->fbcoord, e->v2->fbcoord)
   {
     for (int i = 0; i < nba->triangle_count; i++) {
@@ -405,6 +409,19 @@ static void lineart_occlusion_single_line(LineartData *ld, LineartEdge *e, int t
       {
         continue;
       }
+      /* Most triangles in a bounding area don't overlap the edge. Reject those before marking the
+       * triangle as tested, so threads don't keep writing to the same triangles. Such triangles
+       * are rejected again cheaply if the edge reaches them through another bounding area. */
+      const double *t0 = tri->base.v[0]->fbcoord, *t1 = tri->base.v[1]->fbcoord,
+                   *t2 = tri->base.v[2]->fbcoord;
+      if ((std::max({t0[0], t1[0], t2[0]}) < e_min_x) ||
+          (std::min({t0[0], t1[0], t2[0]}) > e_max_x) ||
+          (std::max({t0[1], t1[1], t2[1]}) < e_min_y) ||
+          (std::min({t0[1], t1[1], t2[1]}) > e_max_y) ||
+          (std::min({t0[3], t1[3], t2[3]}) > e_max_depth))
+      {
+        continue;
+      }
       tri->testing_e[thread_id] = e;
       if (lineart_triangle_edge_image_space_occlusion((const LineartTriangle *)tri,
                                                       e,
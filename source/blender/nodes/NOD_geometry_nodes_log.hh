@@ -180,6 +180,11 @@ class GeometryInfoLog : public ValueLog {
   std::optional<EditDataInfo> edit_data_info;
   std::optional<VolumeInfo> volume_info;
   std::optional<GridInfo> grid_info;
+  /**
+   * Approximate number of bytes used by the geometry. Implicitly shared data is only counted
+   * once, even if it is used by multiple components or instances.
+   */
+  int64_t memory_bytes = 0;
 
   GeometryInfoLog(const bke::GeometrySet &geometry_set);
   GeometryInfoLog(const bke::GVolumeGrid &grid);
@@ -6,8 +6,17 @@
  * \ingroup cmpnodes
  */
 
+#include <complex>
+
+#if defined(WITH_FFTW3)
+#  include <fftw3.h>
+#endif
+
+#include "BLI_fftw.hh"
 #include "BLI_math_base.hh"
+#include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 
 #include "UI_interface.hh"
 #include "UI_resources.hh"
@@ -134,10 +143,22 @@ class BokehBlurOperation : public NodeOperation {
     input_mask.unbind_as_texture();
   }
 
+  /* The cost of the direct convolution grows quadratically with the radius, while the cost of the
+   * convolution in the frequency domain doesn't depend on it, so use the latter for large radii.
+   */
+  static constexpr int fft_radius_threshold = 32;
+
   void execute_constant_size_cpu(const Result &input)
   {
     const int radius = int(this->compute_blur_radius());
 
+#if defined(WITH_FFTW3)
+    if (radius >= fft_radius_threshold) {
+      this->execute_constant_size_cpu_fft(input, radius);
+      return;
+    }
+#endif
+
     const Result &mask_image = this->get_input("Bounding box");
 
     const Domain domain = input.domain();
@@ -173,6 +194,154 @@ class BokehBlurOperation : public NodeOperation {
     blur_kernel.release();
   }
 
+#if defined(WITH_FFTW3)
+  /* Identical to the direct convolution in execute_constant_size_cpu, but done by multiplying the
+   * image and the kernel in the frequency domain. */
+  void execute_constant_size_cpu_fft(const Result &input, const int radius)
+  {
+    const Domain domain = input.domain();
+    const int2 image_size = domain.size;
+
+    /* The convolution in the frequency domain is circular, so pad the image by the radius on both
+     * sides. The padding is filled by extending the boundary of the image, matching the extended
+     * loads of the direct convolution. */
+    const int2 spatial_size = fftw::optimal_size_for_real_transform(image_size + radius * 2);
+
+    /* See the fog glow glare for more information on the layout of the real transforms. */
+    const int2 frequency_size = int2(spatial_size.x / 2 + 1, spatial_size.y);
+
+    const int channels_count = 4;
+    const int64_t spatial_pixels_per_channel = int64_t(spatial_size.x) * spatial_size.y;
+    const int64_t frequency_pixels_per_channel = int64_t(frequency_size.x) * frequency_size.y;
+
+    float *image_spatial_domain = fftwf_alloc_real(spatial_pixels_per_channel * channels_count);
+    std::complex<float> *image_frequency_domain = reinterpret_cast<std::complex<float> *>(
+        fftwf_alloc_complex(frequency_pixels_per_channel * channels_count));
+    float *kernel_spatial_domain = fftwf_alloc_real(spatial_pixels_per_channel);
+    std::complex<float> *kernel_frequency_domain = reinterpret_cast<std::complex<float> *>(
+        fftwf_alloc_complex(frequency_pixels_per_channel));
+
+    fftwf_plan forward_plan = fftwf_plan_dft_r2c_2d(
+        spatial_size.y,
+        spatial_size.x,
+        image_spatial_domain,
+        reinterpret_cast<fftwf_complex *>(image_frequency_domain),
+        FFTW_ESTIMATE);
+    fftwf_plan backward_plan = fftwf_plan_dft_c2r_2d(
+        spatial_size.y,
+        spatial_size.x,
+        reinterpret_cast<fftwf_complex *>(image_frequency_domain),
+        image_spatial_domain,
+        FFTW_ESTIMATE);
+
+    /* Map a coordinate in the spatial domain to the image, the coordinates after the image and the
+     * first half of the padding wrap around to the negative side of the image. */
+    auto image_coordinate = [](const int spatial, const int image, const int padded) {
+      const int coordinate = spatial < image + (padded - image) / 2 ? spatial : spatial - padded;
+      return math::clamp(coordinate, 0, image - 1);
+    };
+
+    /* Store the padded image in planar format, that is, RRRR...GGGG...BBBB...AAAA. */
+    threading::parallel_for(IndexRange(spatial_size.y), 1, [&](const IndexRange sub_y_range) {
+      for (const int64_t y : sub_y_range) {
+        const int image_y = image_coordinate(y, image_size.y, spatial_size.y);
+        for (const int64_t x : IndexRange(spatial_size.x)) {
+          const int image_x = image_coordinate(x, image_size.x, spatial_size.x);
+          const float4 color = input.load_pixel<float4>(int2(image_x, image_y));
+          for (const int64_t channel : IndexRange(channels_count)) {
+            image_spatial_domain[x + y * spatial_size.x + spatial_pixels_per_channel * channel] =
+                color[channel];
+          }
+        }
+      }
+    });
+
+    threading::parallel_for(IndexRange(channels_count), 1, [&](const IndexRange sub_range) {
+      for (const int64_t channel : sub_range) {
+        fftwf_execute_dft_r2c(forward_plan,
+                              image_spatial_domain + spatial_pixels_per_channel * channel,
+                              reinterpret_cast<fftwf_complex *>(image_frequency_domain) +
+                                  frequency_pixels_per_channel * channel);
+      }
+    });
+
+    Result blur_kernel = this->compute_blur_kernel(radius);
+
+    /* The direct convolution accumulates input(texel + offset) * kernel(offset), so the kernel is
+     * stored mirrored. Each channel of the kernel is transformed and multiplied with the image in
+     * turn to avoid storing all channels of the kernel. */
+    for (const int channel : IndexRange(channels_count)) {
+      std::fill_n(kernel_spatial_domain, spatial_pixels_per_channel, 0.0f);
+      float weights_sum = 0.0f;
+      for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+          const float weight = blur_kernel.load_pixel<float4>(int2(x, y) + radius)[channel];
+          const int64_t spatial_x = x > 0 ? spatial_size.x - x : -x;
+          const int64_t spatial_y = y > 0 ? spatial_size.y - y : -y;
+          kernel_spatial_domain[spatial_x + spatial_y * spatial_size.x] = weight;
+          weights_sum += weight;
+        }
+      }
+
+      fftwf_execute_dft_r2c(forward_plan,
+                            kernel_spatial_domain,
+                            reinterpret_cast<fftwf_complex *>(kernel_frequency_domain));
+
+      /* The FFT is not normalized, so divide by the number of pixels in addition to normalizing
+       * the kernel weights. */
+      const float normalization_scale = math::safe_rcp(weights_sum *
+                                                       float(spatial_pixels_per_channel));
+      std::complex<float> *channel_frequency_domain = image_frequency_domain +
+                                                      frequency_pixels_per_channel * channel;
+      threading::parallel_for(
+          IndexRange(frequency_pixels_per_channel), 4096, [&](const IndexRange sub_range) {
+            for (const int64_t i : sub_range) {
+              channel_frequency_domain[i] *= kernel_frequency_domain[i] * normalization_scale;
+            }
+          });
+    }
+
+    blur_kernel.release();
+
+    threading::parallel_for(IndexRange(channels_count), 1, [&](const IndexRange sub_range) {
+      for (const int64_t channel : sub_range) {
+        fftwf_execute_dft_c2r(backward_plan,
+                              reinterpret_cast<fftwf_complex *>(image_frequency_domain) +
+                                  frequency_pixels_per_channel * channel,
+                              image_spatial_domain + spatial_pixels_per_channel * channel);
+      }
+    });
+
+    const Result &mask_image = this->get_input("Bounding box");
+
+    Result &output = this->get_result("Image");
+    output.allocate_texture(domain);
+
+    parallel_for(domain.size, [&](const int2 texel) {
+      /* The mask input is treated as a boolean, see execute_constant_size_cpu. */
+      float mask = mask_image.load_pixel<float, true>(texel);
+      if (mask == 0.0f) {
+        output.store_pixel(texel, input.load_pixel<float4>(texel));
+        return;
+      }
+
+      float4 color;
+      for (const int channel : IndexRange(channels_count)) {
+        color[channel] = image_spatial_domain[texel.x + int64_t(texel.y) * spatial_size.x +
+                                              spatial_pixels_per_channel * channel];
+      }
+      output.store_pixel(texel, color);
+    });
+
+    fftwf_destroy_plan(forward_plan);
+    fftwf_destroy_plan(backward_plan);
+    fftwf_free(image_spatial_domain);
+    fftwf_free(image_frequency_domain);
+    fftwf_free(kernel_spatial_domain);
+    fftwf_free(kernel_frequency_domain);
+  }
+#endif
+
   void execute_variable_size(const Result &input, const Result &size)
   {
     if (this->context().use_gpu()) {
@@ -2,8 +2,16 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_generic_key.hh"
+#include "BLI_listbase.h"
+#include "BLI_memory_cache.hh"
+#include "BLI_memory_counter.hh"
+
+#include "BKE_attribute_storage.hh"
 #include "BKE_geometry_set_instances.hh"
 #include "BKE_instances.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
 
 #include "DNA_mesh_types.h"
 #include "DNA_object_types.h"
@@ -100,6 +108,240 @@ static Array<short> calc_mesh_material_map(const Mesh &mesh, VectorSet<Material
   return map;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Result Cache
+ *
+ * Boolean results are kept in the global memory cache, so that the operation does not have to be
+ * recomputed when evaluating the node tree again with inputs that did not change, e.g. when only
+ * a node further downstream was modified.
+ *
+ * The inputs are identified by the implicitly shared arrays they reference instead of their
+ * contents. That makes building the key cheap, but it only finds results when the input data was
+ * not recomputed, e.g. when it comes from another object that did not change.
+ * \{ */
+
+/** Identifies an implicitly shared array and the state of its data. */
+struct SharedArrayIdentity {
+  WeakImplicitSharingPtr sharing_info;
+  int64_t version;
+  std::string name;
+  int type;
+  int domain;
+
+  uint64_t hash() const
+  {
+    return get_default_hash(this->sharing_info.get(), this->version, this->name);
+  }
+
+  BLI_STRUCT_EQUALITY_OPERATORS_5(SharedArrayIdentity, sharing_info, version, name, type, domain)
+};
+
+struct MeshIdentity {
+  int verts_num;
+  int edges_num;
+  int faces_num;
+  int corners_num;
+  Vector<SharedArrayIdentity> arrays;
+  Vector<std::string> vertex_group_names;
+
+  uint64_t hash() const
+  {
+    return get_default_hash(this->verts_num, this->faces_num, this->arrays);
+  }
+
+  BLI_STRUCT_EQUALITY_OPERATORS_6(
+      MeshIdentity, verts_num, edges_num, faces_num, corners_num, arrays, vertex_group_names)
+};
+
+static bool add_shared_array_identity(const ImplicitSharingInfo *sharing_info,
+                                      const StringRef name,
+                                      const int type,
+                                      const int domain,
+                                      Vector<SharedArrayIdentity> &r_arrays)
+{
+  if (sharing_info == nullptr) {
+    return false;
+  }
+  /* A weak user keeps the sharing info alive, so that its address can't be reused for different
+   * data while the key exists. */
+  sharing_info->add_weak_user();
+  r_arrays.append(
+      {WeakImplicitSharingPtr(sharing_info), sharing_info->version(), name, type, domain});
+  return true;
+}
+
+/**
+ * \return None if some of the mesh data is not implicitly shared, in which case the result can't
+ * be cached.
+ */
+static std::optional<MeshIdentity> mesh_identity_get(const Mesh &mesh)
+{
+  MeshIdentity identity;
+  identity.verts_num = mesh.verts_num;
+  identity.edges_num = mesh.edges_num;
+  identity.faces_num = mesh.faces_num;
+  identity.corners_num = mesh.corners_num;
+  if (mesh.faces_num > 0) {
+    if (!add_shared_array_identity(
+            mesh.runtime->face_offsets_sharing_info, "", -1, -1, identity.arrays))
+    {
+      return std::nullopt;
+    }
+  }
+  const std::array<const CustomData *, 4> custom_data = {
+      &mesh.vert_data, &mesh.edge_data, &mesh.face_data, &mesh.corner_data};
+  for (const int domain : IndexRange(custom_data.size())) {
+    for (const CustomDataLayer &layer :
+         Span(custom_data[domain]->layers, custom_data[domain]->totlayer))
+    {
+      if (layer.data == nullptr) {
+        continue;
+      }
+      if (!add_shared_array_identity(
+              layer.sharing_info, layer.name, layer.type, domain, identity.arrays))
+      {
+        return std::nullopt;
+      }
+    }
+  }
+  bool all_shared = true;
+  mesh.attribute_storage.wrap().foreach([&](const bke::Attribute &attribute) {
+    const ImplicitSharingInfo *sharing_info = nullptr;
+    if (const auto *data = std::get_if<bke::Attribute::ArrayData>(&attribute.data())) {
+      sharing_info = data->sharing_info.get();
+    }
+    else if (const auto *data = std::get_if<bke::Attribute::SingleData>(&attribute.data())) {
+      sharing_info = data->sharing_info.get();
+    }
+    all_shared &= add_shared_array_identity(sharing_info,
+                                            attribute.name(),
+                                            int(attribute.data_type()),
+                                            int(attribute.domain()),
+                                            identity.arrays);
+  });
+  if (!all_shared) {
+    return std::nullopt;
+  }
+  LISTBASE_FOREACH (const bDeformGroup *, group, &mesh.vertex_group_names) {
+    identity.vertex_group_names.append(group->name);
+  }
+  return identity;
+}
+
+class BooleanCacheKey : public GenericKey {
+ public:
+  geometry::boolean::Operation operation;
+  geometry::boolean::Solver solver;
+  bool use_self;
+  bool hole_tolerant;
+  bool with_intersecting_edges;
+  Vector<MeshIdentity> meshes;
+  Vector<float4x4> transforms;
+  Vector<Vector<short>> material_remaps;
+
+  uint64_t hash() const override
+  {
+    return get_default_hash(get_default_hash(int(this->operation), int(this->solver)),
+                            this->meshes,
+                            this->transforms);
+  }
+
+  friend bool operator==(const BooleanCacheKey &a, const BooleanCacheKey &b)
+  {
+    return a.operation == b.operation && a.solver == b.solver && a.use_self == b.use_self &&
+           a.hole_tolerant == b.hole_tolerant &&
+           a.with_intersecting_edges == b.with_intersecting_edges && a.meshes == b.meshes &&
+           a.transforms == b.transforms && a.material_remaps == b.material_remaps;
+  }
+
+  bool equal_to(const GenericKey &other) const override
+  {
+    if (const auto *other_typed = dynamic_cast<const BooleanCacheKey *>(&other)) {
+      return *this == *other_typed;
+    }
+    return false;
+  }
+
+  std::unique_ptr<GenericKey> to_storable() const override
+  {
+    return std::make_unique<BooleanCacheKey>(*this);
+  }
+};
+
+class BooleanCacheValue : public memory_cache::CachedValue {
+ public:
+  Mesh *mesh = nullptr;
+  Vector<int> intersecting_edges;
+  geometry::boolean::BooleanError error = geometry::boolean::BooleanError::NoError;
+
+  ~BooleanCacheValue() override
+  {
+    if (this->mesh) {
+      BKE_id_free(nullptr, this->mesh);
+    }
+  }
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    if (this->mesh) {
+      this->mesh->count_memory(memory);
+    }
+    memory.add(this->intersecting_edges.as_span().size_in_bytes());
+  }
+};
+
+static Mesh *mesh_boolean_cached(const Span<const Mesh *> meshes,
+                                 const Span<float4x4> transforms,
+                                 const Span<Array<short>> material_remaps,
+                                 const geometry::boolean::BooleanOpParameters &op_params,
+                                 const geometry::boolean::Solver solver,
+                                 Vector<int> *r_intersecting_edges,
+                                 geometry::boolean::BooleanError *r_error)
+{
+  BooleanCacheKey key;
+  key.operation = op_params.boolean_mode;
+  key.solver = solver;
+  key.use_self = !op_params.no_self_intersections;
+  key.hole_tolerant = !op_params.watertight;
+  key.with_intersecting_edges = r_intersecting_edges != nullptr;
+  key.transforms = transforms;
+  for (const int i : meshes.index_range()) {
+    std::optional<MeshIdentity> identity = mesh_identity_get(*meshes[i]);
+    if (!identity) {
+      return geometry::boolean::mesh_boolean(
+          meshes, transforms, material_remaps, op_params, solver, r_intersecting_edges, r_error);
+    }
+    key.meshes.append(std::move(*identity));
+    key.material_remaps.append(Vector<short>(material_remaps[i].as_span()));
+  }
+
+  const std::shared_ptr<const BooleanCacheValue> value = memory_cache::get<BooleanCacheValue>(
+      key, [&]() {
+        auto value = std::make_unique<BooleanCacheValue>();
+        value->mesh = geometry::boolean::mesh_boolean(meshes,
+                                                      transforms,
+                                                      material_remaps,
+                                                      op_params,
+                                                      solver,
+                                                      r_intersecting_edges ?
+                                                          &value->intersecting_edges :
+                                                          nullptr,
+                                                      &value->error);
+        return value;
+      });
+  *r_error = value->error;
+  if (r_intersecting_edges) {
+    *r_intersecting_edges = value->intersecting_edges;
+  }
+  if (value->mesh == nullptr) {
+    return nullptr;
+  }
+  /* The cached mesh is shared with the result, its arrays are only copied when modified. */
+  return BKE_mesh_copy_for_eval(*value->mesh);
+}
+
+/** \} */
+
 static void node_geo_exec(GeoNodeExecParams params)
 {
   geometry::boolean::Operation operation = geometry::boolean::Operation(params.node().custom1);
@@ -190,7 +432,7 @@ static void node_geo_exec(GeoNodeExecParams params)
   op_params.watertight = !hole_tolerant;
   op_params.no_nested_components = true; /* TODO: make this configurable. */
   geometry::boolean::BooleanError error = geometry::boolean::BooleanError::NoError;
-  Mesh *result = geometry::boolean::mesh_boolean(
+  Mesh *result = mesh_boolean_cached(
       meshes,
       transforms,
       material_remaps,
@@ -198,6 +198,14 @@ class RaycastFunction : public mf::MultiFunction {
                     params.uninitialized_single_output_if_required<float3>(5, "Hit Normal"),
                     params.uninitialized_single_output_if_required<float>(6, "Distance"));
   }
+
+  ExecutionHints get_execution_hints() const override
+  {
+    /* Every ray traverses the BVH tree, so use a smaller grain size than for cheap functions. */
+    ExecutionHints hints;
+    hints.min_grain_size = 512;
+    return hints;
+  }
 };
 
 static void node_geo_exec(GeoNodeExecParams params)
@@ -141,6 +141,13 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Sample positions are often spatially coherent. The previous result is used to initialize
+     * the search distance, which allows pruning most of the tree. The tree is traversed in the
+     * same order regardless of that distance, and the first triangle at the smallest distance
+     * wins. The distance is slightly enlarged so that triangles tied with the previous one are
+     * still found, which makes the result the same as a search from scratch. */
+    int prev_group_index = -1;
+    BVHTreeNearest nearest;
     mask.foreach_index([&](const int i) {
       const float3 position = positions[i];
       const int sample_id = sample_ids[i];
@@ -154,14 +161,27 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
         return;
       }
       const bke::BVHTreeFromMesh &bvh = bvh_trees_[group_index];
-      BVHTreeNearest nearest;
-      nearest.dist_sq = FLT_MAX;
+      const bool use_prev = group_index == prev_group_index && nearest.index != -1;
+      nearest.dist_sq = use_prev ?
+                            math::distance_squared(position, float3(nearest.co)) * 1.01f +
+                                FLT_EPSILON :
+                            FLT_MAX;
       nearest.index = -1;
+      prev_group_index = group_index;
       BLI_bvhtree_find_nearest(bvh.tree,
                                position,
                                &nearest,
                                bvh.nearest_callback,
                                const_cast<bke::BVHTreeFromMesh *>(&bvh));
+      if (use_prev && nearest.index == -1) {
+        /* Only possible because of precision issues, search again without a limit. */
+        nearest.dist_sq = FLT_MAX;
+        BLI_bvhtree_find_nearest(bvh.tree,
+                                 position,
+                                 &nearest,
+                                 bvh.nearest_callback,
+                                 const_cast<bke::BVHTreeFromMesh *>(&bvh));
+      }
       triangle_index[i] = nearest.index;
       sample_position[i] = nearest.co;
       if (!is_valid_span.is_empty()) {
@@ -1049,17 +1049,44 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
       }
       attributes_to_propagate.append({iter.name, iter.data_type});
     });
-    Map<StringRef, GVArray> cached_adapted_src_attributes;
 
     const IndexMask mask = component_info.field_evaluator->get_evaluated_selection_as_mask();
 
-    /* Add attributes for each field on the geometry created by each iteration. */
-    mask.foreach_index([&](const int element_i, const int local_body_i) {
+    /* Get the source attributes adapted to the iteration domain. This is done before the loop
+     * below, so that it can process the iterations in parallel. */
+    Map<StringRef, GVArray> adapted_src_attributes;
+    if (!mask.is_empty()) {
+      for (const NameWithType &name_with_type : attributes_to_propagate) {
+        const bke::GAttributeReader attribute = src_attributes.lookup(name_with_type.name);
+        adapted_src_attributes.add(
+            name_with_type.name,
+            src_attributes.adapt_domain(*attribute, attribute.domain, component_info.id.domain));
+      }
+    }
+
+    /* Retrieve the values from all iterations first, so that the parameters are not accessed
+     * from multiple threads below. */
+    const int64_t items_num = generation_items_range.size();
+    Array<GField> fields(mask.size() * items_num);
+    mask.foreach_index([&](const int /*element_i*/, const int local_body_i) {
       const int body_i = component_info.body_nodes_range[local_body_i];
       const int geometry_param_i = body_i * body_main_outputs_num +
                                    parent_.indices_.generation.lf_inner[geometry_item_i];
+      geometries[body_i] = params.extract_input<GeometrySet>(geometry_param_i);
+      for (const int local_item_i : generation_items_range.index_range()) {
+        const int item_i = generation_items_range[local_item_i];
+        const int field_param_i = body_i * body_main_outputs_num +
+                                  parent_.indices_.generation.lf_inner[item_i];
+        fields[local_body_i * items_num + local_item_i] =
+            params.get_input<SocketValueVariant>(field_param_i).get<GField>();
+      }
+    });
+
+    /* Add attributes for each field on the geometry created by each iteration. Every iteration
+     * only modifies its own geometry. */
+    mask.foreach_index(GrainSize(128), [&](const int element_i, const int local_body_i) {
+      const int body_i = component_info.body_nodes_range[local_body_i];
       GeometrySet &geometry = geometries[body_i];
-      geometry = params.extract_input<GeometrySet>(geometry_param_i);
 
       for (const GeometryComponent::Type dst_component_type :
            {GeometryComponent::Type::Mesh,
@@ -1093,13 +1120,7 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
             /* Attributes created in the zone shouldn't be overridden. */
             continue;
           }
-          /* Get the source attribute adapted to the iteration domain. */
-          const GVArray &src_attribute = cached_adapted_src_attributes.lookup_or_add_cb(
-              name, [&]() {
-                bke::GAttributeReader attribute = src_attributes.lookup(name);
-                return src_attributes.adapt_domain(
-                    *attribute, attribute.domain, component_info.id.domain);
-              });
+          const GVArray &src_attribute = adapted_src_attributes.lookup(name);
           if (!src_attribute) {
             continue;
           }
@@ -1123,9 +1144,7 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
         const NodeForeachGeometryElementGenerationItem &item =
             node_storage.generation_items.items[item_i];
         const AttrDomain capture_domain = AttrDomain(item.domain);
-        const int field_param_i = body_i * body_main_outputs_num +
-                                  parent_.indices_.generation.lf_inner[item_i];
-        GField field = params.get_input<SocketValueVariant>(field_param_i).get<GField>();
+        const GField &field = fields[local_body_i * items_num + local_item_i];
 
         if (capture_domain == AttrDomain::Instance) {
           if (geometry.has_instances()) {
@@ -1207,6 +1207,7 @@ class LazyFunctionForGroupNode : public LazyFunction {
     outputs_ = group_lf_graph_info.function.function->outputs();
 
     has_many_nodes_ = group_lf_graph_info.num_inline_nodes_approximate > 1000;
+    is_expensive_ = has_many_nodes_;
 
     /* Add a boolean input for every output bsocket that indicates whether that socket is used. */
     for (const int i : group_node.output_sockets().index_range()) {
@@ -8,6 +8,7 @@
 #include "NOD_geometry_nodes_log.hh"
 
 #include "BLI_listbase.h"
+#include "BLI_memory_counter.hh"
 #include "BLI_stack.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
@@ -193,6 +194,11 @@ GeometryInfoLog::GeometryInfoLog(const bke::GeometrySet &geometry_set)
       }
     }
   }
+
+  MemoryCount memory_count;
+  MemoryCounter memory{memory_count};
+  geometry_set.count_memory(memory);
+  this->memory_bytes = memory_count.total_bytes;
 }
 
 #ifdef WITH_OPENVDB
@@ -187,6 +187,12 @@ class LazyFunctionForRepeatZone : public LazyFunction {
    * but right now that doesn't seem worth it. In practice, it takes much less time to create the
    * graph than to execute it (for intended use cases of this generic implementation, more special
    * case repeat loop evaluations could be implemented separately).
+   *
+   * Iterations are not evaluated strictly one after another. Parts of a loop body that don't
+   * depend on the previous iteration can be computed as soon as the body node runs, and the
+   * #lazy_threading hints sent by expensive nodes inside of the body move the work for previous
+   * iterations to other threads. Loops where iterations are fully independent are better
+   * expressed with the For Each Geometry Element zone, which evaluates its bodies in parallel.
    */
   void initialize_execution_graph(lf::Params &params,
                                   RepeatEvalStorage &eval_storage,
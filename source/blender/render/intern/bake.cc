@@ -728,19 +728,13 @@ void RE_bake_pixels_populate(Mesh *mesh,
     return;
   }
 
-  BakeDataZSpan bd;
-  bd.pixel_array = pixel_array;
-  bd.zspan = MEM_calloc_arrayN<ZSpan>(targets->images_num, "bake zspan");
-
   /* initialize all pixel arrays so we know which ones are 'blank' */
-  for (int i = 0; i < pixels_num; i++) {
-    pixel_array[i].primitive_id = -1;
-    pixel_array[i].object_id = 0;
-  }
-
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_alloc_span(&bd.zspan[i], targets->images[i].width, targets->images[i].height);
-  }
+  threading::parallel_for(IndexRange(pixels_num), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      pixel_array[i].primitive_id = -1;
+      pixel_array[i].object_id = 0;
+    }
+  });
 
   const int tottri = poly_to_tri_count(mesh->faces_num, mesh->corners_num);
   blender::int3 *corner_tris = MEM_malloc_arrayN<blender::int3>(size_t(tottri), __func__);
@@ -755,50 +749,59 @@ void RE_bake_pixels_populate(Mesh *mesh,
 
   const int materials_num = targets->materials_num;
 
-  for (int i = 0; i < tottri; i++) {
-    const int3 &tri = corner_tris[i];
-    const int face_i = tri_faces[i];
+  /* Every image writes to its own range of the pixel array and has its own span buffer, so the
+   * images are rasterized in parallel. The triangles of an image are still rasterized in order,
+   * where UVs overlap the last triangle keeps the pixel. */
+  threading::parallel_for(IndexRange(targets->images_num), 1, [&](const IndexRange range) {
+    for (const int image_id : range) {
+      BakeImage *bk_image = &targets->images[image_id];
 
-    bd.primitive_id = i;
+      ZSpan zspan;
+      zbuf_alloc_span(&zspan, bk_image->width, bk_image->height);
 
-    /* Find images matching this material. */
-    const int material_index = (!material_indices.is_empty() && materials_num) ?
-                                   clamp_i(material_indices[face_i], 0, materials_num - 1) :
-                                   0;
-    Image *image = targets->material_to_image[material_index];
-    for (int image_id = 0; image_id < targets->images_num; image_id++) {
-      BakeImage *bk_image = &targets->images[image_id];
-      if (bk_image->image != image) {
-        continue;
-      }
+      BakeDataZSpan bd;
+      bd.pixel_array = pixel_array;
+      bd.bk_image = bk_image;
+      bd.zspan = &zspan;
+
+      for (int i = 0; i < tottri; i++) {
+        const int3 &tri = corner_tris[i];
+        const int face_i = tri_faces[i];
+
+        /* Skip triangles with a material that doesn't bake to this image. */
+        const int material_index = (!material_indices.is_empty() && materials_num) ?
+                                       clamp_i(material_indices[face_i], 0, materials_num - 1) :
+                                       0;
+        if (targets->material_to_image[material_index] != bk_image->image) {
+          continue;
+        }
+
+        bd.primitive_id = i;
+
+        /* Compute triangle vertex UV coordinates. */
+        float vec[3][2];
+        for (int a = 0; a < 3; a++) {
+          const float *uv = mloopuv[tri[a]];
+
+          /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
+           * up our intersection tests where a pixel gets in between 2 faces or the middle of a
+           * quad, camera aligned quads also have this problem but they are less common.
+           * Add a small offset to the UVs, fixes bug #18685. */
+          vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) - (0.5f + 0.001f);
+          vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) -
+                      (0.5f + 0.002f);
+        }
 
-      /* Compute triangle vertex UV coordinates. */
-      float vec[3][2];
-      for (int a = 0; a < 3; a++) {
-        const float *uv = mloopuv[tri[a]];
-
-        /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
-         * up our intersection tests where a pixel gets in between 2 faces or the middle of a quad,
-         * camera aligned quads also have this problem but they are less common.
-         * Add a small offset to the UVs, fixes bug #18685. */
-        vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) - (0.5f + 0.001f);
-        vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) - (0.5f + 0.002f);
+        /* Rasterize triangle. */
+        bake_differentials(&bd, vec[0], vec[1], vec[2]);
+        zspan_scanconvert(&zspan, (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
       }
 
-      /* Rasterize triangle. */
-      bd.bk_image = bk_image;
-      bake_differentials(&bd, vec[0], vec[1], vec[2]);
-      zspan_scanconvert(
-          &bd.zspan[image_id], (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
+      zbuf_free_span(&zspan);
     }
-  }
-
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_free_span(&bd.zspan[i]);
-  }
+  });
 
   MEM_freeN(corner_tris);
-  MEM_freeN(bd.zspan);
 }
 
 /* ******************** NORMALS ************************ */
@@ -6,6 +6,7 @@
  * \ingroup render
  */
 
+#include <algorithm>
 #include <cstring>
 
 #include "MEM_guardedalloc.h"
@@ -13,6 +14,7 @@
 #include "DNA_modifier_types.h"
 #include "DNA_scene_types.h"
 
+#include "BLI_index_range.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_color.h"
 #include "BLI_math_geom.h"
@@ -371,22 +373,25 @@ struct MultiresBakeThread {
   float height_min, height_max;
 };
 
-static int multires_bake_queue_next_tri(MultiresBakeQueue *queue)
-{
-  int face = -1;
+/**
+ * Number of triangles a thread takes from the queue at once. Neighboring triangles tend to
+ * cover neighboring pixels, and the lock is taken less often.
+ */
+#define MULTIRES_BAKE_QUEUE_CHUNK_SIZE 64
 
-  /* TODO: it could worth making it so thread will handle neighbor faces
-   *       for better memory cache utilization
-   */
+static blender::IndexRange multires_bake_queue_next_tris(MultiresBakeQueue *queue)
+{
+  blender::IndexRange tris;
 
   BLI_spin_lock(&queue->spin);
   if (queue->cur_tri < queue->tot_tri) {
-    face = queue->cur_tri;
-    queue->cur_tri++;
+    const int tris_num = std::min(MULTIRES_BAKE_QUEUE_CHUNK_SIZE, queue->tot_tri - queue->cur_tri);
+    tris = blender::IndexRange(queue->cur_tri, tris_num);
+    queue->cur_tri += tris_num;
   }
   BLI_spin_unlock(&queue->spin);
 
-  return face;
+  return tris;
 }
 
 static void *do_multires_bake_thread(void *data_v)
@@ -395,30 +400,42 @@ static void *do_multires_bake_thread(void *data_v)
   MResolvePixelData *data = &handle->data;
   MBakeRast *bake_rast = &handle->bake_rast;
   MultiresBakeRender *bkr = handle->bkr;
-  int tri_index;
+  blender::IndexRange tris;
+  bool is_break = false;
 
-  while ((tri_index = multires_bake_queue_next_tri(handle->queue)) >= 0) {
-    const blender::int3 &tri = data->corner_tris[tri_index];
-    const int face_i = data->tri_faces[tri_index];
-    const short mat_nr = data->material_indices == nullptr ? 0 : data->material_indices[face_i];
+  while (!is_break && !(tris = multires_bake_queue_next_tris(handle->queue)).is_empty()) {
+    int baked_faces = 0;
 
-    if (multiresbake_test_break(bkr)) {
-      break;
-    }
+    for (const int tri_index : tris) {
+      const blender::int3 &tri = data->corner_tris[tri_index];
+      const int face_i = data->tri_faces[tri_index];
+      const short mat_nr = data->material_indices == nullptr ? 0 :
+                                                               data->material_indices[face_i];
 
-    Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : nullptr;
-    if (tri_image != handle->image) {
-      continue;
-    }
+      if (multiresbake_test_break(bkr)) {
+        is_break = true;
+        break;
+      }
+
+      Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : nullptr;
+      if (tri_image != handle->image) {
+        continue;
+      }
 
-    data->tri_index = tri_index;
+      data->tri_index = tri_index;
 
-    float uv[3][2];
-    sub_v2_v2v2(uv[0], data->uv_map[tri[0]], data->uv_offset);
-    sub_v2_v2v2(uv[1], data->uv_map[tri[1]], data->uv_offset);
-    sub_v2_v2v2(uv[2], data->uv_map[tri[2]], data->uv_offset);
+      float uv[3][2];
+      sub_v2_v2v2(uv[0], data->uv_map[tri[0]], data->uv_offset);
+      sub_v2_v2v2(uv[1], data->uv_map[tri[1]], data->uv_offset);
+      sub_v2_v2v2(uv[2], data->uv_map[tri[2]], data->uv_offset);
 
-    bake_rasterize(bake_rast, uv[0], uv[1], uv[2]);
+      bake_rasterize(bake_rast, uv[0], uv[1], uv[2]);
+      baked_faces++;
+    }
+
+    if (baked_faces == 0) {
+      continue;
+    }
 
     /* tag image buffer for refresh */
     if (data->ibuf->float_buffer.data) {
@@ -429,7 +446,7 @@ static void *do_multires_bake_thread(void *data_v)
 
     /* update progress */
     BLI_spin_lock(&handle->queue->spin);
-    bkr->baked_faces++;
+    bkr->baked_faces += baked_faces;
 
     if (bkr->do_update) {
       *bkr->do_update = true;
@@ -4,6 +4,12 @@
 
 /** \file
  * \ingroup sequencer
+ *
+ * Cache of the final composited frames, kept in memory only.
+ *
+ * \note There is no disk tier. Reading a compressed frame back from disk is only faster than
+ * rendering it again for heavy timelines, while the disk space, invalidation on every edit and the
+ * file management cost apply to all of them. Proxies cover playback of heavy source media.
  */
 
 #include "BLI_map.hh"
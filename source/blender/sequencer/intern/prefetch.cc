@@ -579,6 +579,10 @@ static PrefetchJob *seq_prefetch_start_ex(const RenderData *context, float cfra)
     pfjob = MEM_new<PrefetchJob>("PrefetchJob");
     context->scene->ed->prefetch_job = pfjob;
 
+    /* NOTE: A single prefetch thread renders the frames in order. Every worker would need its own
+     * evaluated copy of the scene and its own movie readers (the readers of the original strips
+     * are not thread-safe), and strip rendering already runs effects, transforms and FFmpeg
+     * decoding with multiple threads. */
     BLI_threadpool_init(&pfjob->threads, seq_prefetch_frames, 1);
     BLI_mutex_init(&pfjob->prefetch_suspend_mutex);
     BLI_condition_init(&pfjob->prefetch_suspend_cond);
@@ -1843,6 +1843,10 @@ static bool is_opaque_alpha_over(const Strip *strip)
   return true;
 }
 
+/* NOTE: The stack is blended on the CPU, in parallel over rows. A GPU path would need every
+ * effect, modifier and blend mode implemented twice, and rendering also happens in the prefetch
+ * thread and in final renders, where no GPU context is available. Strips that are fully
+ * covered by opaque strips above them are skipped (see #OpaqueQuadTracker). */
 static ImBuf *seq_render_strip_stack(const RenderData *context,
                                      SeqRenderState *state,
                                      ListBase *channels,
@@ -200,15 +200,17 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
     add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
   }
 }
-/* `A = B + C * float` -> for big vector. */
+/* `A = B + C * float` -> for big vector.
+ * This is called several times per conjugate gradient iteration, so it's worth splitting up. */
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
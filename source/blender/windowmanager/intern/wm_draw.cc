@@ -27,6 +27,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_rect.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_context.hh"
@@ -53,6 +54,9 @@
 
 #include "RE_engine.h"
 
+#include "RNA_access.hh"
+#include "RNA_enum_types.hh"
+
 #include "WM_api.hh"
 #include "WM_toolsystem.hh"
 #include "WM_types.hh"
@@ -64,10 +68,14 @@
 
 #include "UI_resources.hh"
 
+#include "CLG_log.h"
+
 #ifdef WITH_OPENSUBDIV
 #  include "BKE_subsurf.hh"
 #endif
 
+static CLG_LogRef LOG = {"wm.draw"};
+
 /* -------------------------------------------------------------------- */
 /** \name Internal Utilities
  * \{ */
@@ -591,6 +599,26 @@ static const char *wm_area_name(ScrArea *area)
   }
 }
 
+/**
+ * Report the time spent on the layout or drawing of a region, shown with `--log "wm.draw"`.
+ * This is CPU time only, GPU work is submitted asynchronously and not included.
+ */
+static void wm_draw_region_log_time(ScrArea *area,
+                                    const ARegion *region,
+                                    const char *step,
+                                    const double time_start)
+{
+  const char *region_name = "";
+  RNA_enum_identifier(rna_enum_region_type_items, region->regiontype, &region_name);
+  CLOG_INFO(&LOG,
+            1,
+            "%s %s %s: %.2f ms",
+            wm_area_name(area),
+            region_name,
+            step,
+            (BLI_time_now_seconds() - time_start) * 1000.0);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -946,9 +974,14 @@ static void wm_draw_area_offscreen(bContext *C, wmWindow *win, ScrArea *area, bo
     if ((region->runtime->visible || ignore_visibility) && region->runtime->do_draw &&
         region->runtime->type && region->runtime->type->layout)
     {
+      const bool use_log = CLOG_CHECK(&LOG, 1);
+      const double time_start = use_log ? BLI_time_now_seconds() : 0.0;
       CTX_wm_region_set(C, region);
       ED_region_do_layout(C, region);
       CTX_wm_region_set(C, nullptr);
+      if (use_log) {
+        wm_draw_region_log_time(area, region, "layout", time_start);
+      }
     }
   }
 
@@ -968,6 +1001,9 @@ static void wm_draw_area_offscreen(bContext *C, wmWindow *win, ScrArea *area, bo
       continue;
     }
 
+    const bool use_log = CLOG_CHECK(&LOG, 1);
+    const double time_start = use_log ? BLI_time_now_seconds() : 0.0;
+
     CTX_wm_region_set(C, region);
     bool use_viewport = WM_region_use_viewport(area, region);
 
@@ -1007,6 +1043,10 @@ static void wm_draw_area_offscreen(bContext *C, wmWindow *win, ScrArea *area, bo
 
     GPU_debug_group_end();
 
+    if (use_log) {
+      wm_draw_region_log_time(area, region, "draw", time_start);
+    }
+
     region->runtime->do_draw = 0;
     CTX_wm_region_set(C, nullptr);
   }
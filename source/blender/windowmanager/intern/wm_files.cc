@@ -2123,6 +2123,8 @@ static bool wm_file_write(bContext *C,
                           int fileflags,
                           eBLO_WritePathRemap remap_mode,
                           bool use_save_as_copy,
+                          const int compression_level,
+                          const int write_chunk_size,
                           ReportList *reports)
 {
   Main *bmain = CTX_data_main(C);
@@ -2239,6 +2241,8 @@ static bool wm_file_write(bContext *C,
   blend_write_params.remap_mode = remap_mode;
   blend_write_params.use_save_versions = true;
   blend_write_params.use_save_as_copy = use_save_as_copy;
+  blend_write_params.compression_level = compression_level;
+  blend_write_params.write_chunk_size = write_chunk_size;
   blend_write_params.thumb = thumb;
 
   const bool success = BLO_write_file(bmain, filepath, fileflags, &blend_write_params, reports);
@@ -2348,6 +2352,10 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 
   /* Error reporting into console. */
   BlendFileWriteParams params{};
+  /* Consecutive auto-saves mostly write the same data, avoid compressing it again. */
+  params.use_compression_cache = true;
+  /* Don't block the UI for the compression and the file writing. */
+  params.use_background_write = true;
   BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
 
   /* Restart auto-save timer. */
@@ -2412,6 +2420,8 @@ void wm_autosave_timer(Main *bmain, wmWindowManager *wm, wmTimer * /*wt*/)
 
 void wm_autosave_delete()
 {
+  BLO_write_file_background_wait();
+
   char filepath[FILE_MAX];
 
   wm_autosave_location(filepath);
@@ -3753,8 +3763,14 @@ static wmOperatorStatus wm_save_as_mainfile_exec(bContext *C, wmOperator *op)
   /* Set compression flag. */
   SET_FLAG_FROM_TEST(fileflags, RNA_boolean_get(op->ptr, "compress"), G_FILE_COMPRESS);
 
-  const bool success = wm_file_write(
-      C, filepath, fileflags, remap_mode, use_save_as_copy, op->reports);
+  const bool success = wm_file_write(C,
+                                     filepath,
+                                     fileflags,
+                                     remap_mode,
+                                     use_save_as_copy,
+                                     RNA_int_get(op->ptr, "compression_level"),
+                                     RNA_int_get(op->ptr, "chunk_size"),
+                                     op->reports);
 
   if ((op->flag & OP_IS_INVOKE) == 0) {
     /* OP_IS_INVOKE is set when the operator is called from the GUI.
@@ -3843,6 +3859,34 @@ static std::string wm_save_as_mainfile_get_description(bContext * /*C*/,
   return "";
 }
 
+/** Options for scripts saving files, e.g. on render farms. */
+static void wm_save_mainfile_write_options_def(wmOperatorType *ot)
+{
+  PropertyRNA *prop;
+  prop = RNA_def_int(ot->srna,
+                     "compression_level",
+                     0,
+                     0,
+                     22,
+                     "Compression Level",
+                     "Zstandard compression level used when compressing, zero for the default. "
+                     "Higher levels give smaller files but take longer to save",
+                     0,
+                     22);
+  RNA_def_property_flag(prop, PROP_HIDDEN | PROP_SKIP_SAVE);
+  prop = RNA_def_int(ot->srna,
+                     "chunk_size",
+                     0,
+                     0,
+                     INT_MAX,
+                     "Chunk Size",
+                     "Size in bytes of the chunks the file is written in, zero for the default "
+                     "(1 MB). When compressing, larger chunks compress better",
+                     0,
+                     1 << 28);
+  RNA_def_property_flag(prop, PROP_HIDDEN | PROP_SKIP_SAVE);
+}
+
 void WM_OT_save_as_mainfile(wmOperatorType *ot)
 {
   PropertyRNA *prop;
@@ -3878,6 +3922,7 @@ void WM_OT_save_as_mainfile(wmOperatorType *ot)
       "Save Copy",
       "Save a copy of the actual working state but does not make saved file active");
   RNA_def_property_flag(prop, PROP_SKIP_SAVE);
+  wm_save_mainfile_write_options_def(ot);
 }
 
 static wmOperatorStatus wm_save_mainfile_invoke(bContext *C,
@@ -3971,6 +4016,7 @@ void WM_OT_save_mainfile(wmOperatorType *ot)
                          "Save the current Blender file with a numerically incremented name that "
                          "does not overwrite any existing files");
   RNA_def_property_flag(prop, PROP_HIDDEN | PROP_SKIP_SAVE);
+  wm_save_mainfile_write_options_def(ot);
 }
 
 /** \} */
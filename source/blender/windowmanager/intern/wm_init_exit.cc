@@ -23,9 +23,11 @@
 
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
+#include "BLI_profile.hh"
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
 
@@ -192,14 +194,39 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+static CLG_LogRef LOG_STARTUP = {"wm.startup"};
+
+/**
+ * Log the time spent in the steps of #WM_init, shown with `--log "wm.startup"`.
+ * Useful to see what dominates the startup time of short background jobs.
+ */
+struct WMInitTimer {
+  double time_start = BLI_time_now_seconds();
+  double time_step = time_start;
+
+  void step(const char *name)
+  {
+    const double time = BLI_time_now_seconds();
+    CLOG_INFO(&LOG_STARTUP, 1, "%s: %.2f ms", name, (time - time_step) * 1000.0);
+    time_step = time;
+  }
+
+  void total()
+  {
+    CLOG_INFO(&LOG_STARTUP, 1, "total: %.2f ms", (BLI_time_now_seconds() - time_start) * 1000.0);
+  }
+};
+
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  WMInitTimer timer;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
     wm_init_cursor_data();
     BKE_sound_jack_sync_callback_set(sound_jack_sync_callback);
   }
+  timer.step("window-system");
 
   BKE_addon_pref_type_init();
   BKE_keyconfig_pref_type_init();
@@ -224,6 +251,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   ED_spacetypes_init();
 
   ED_node_init_butfuncs();
+  timer.step("types");
 
   BLF_init();
 
@@ -231,18 +259,21 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* Must call first before doing any `.blend` file reading,
    * since versioning code may create new IDs. See #57066. */
   BLT_lang_set(nullptr);
+  timer.step("fonts-and-translations");
 
   /* Init icons & previews before reading .blend files for preview icons, which can
    * get triggered by the depsgraph. This is also done in background mode
    * for scripts that do background processing with preview icons. */
   BKE_icons_init(BIFICONID_LAST_STATIC);
   BKE_preview_images_init();
+  timer.step("icons");
 
   WM_msgbus_types_init();
 
   /* Studio-lights needs to be init before we read the home-file,
    * otherwise the versioning cannot find the default studio-light. */
   BKE_studiolight_init();
+  timer.step("studio-lights");
 
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
@@ -275,6 +306,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   read_homefile_params.is_first_time = true;
 
   wm_homefile_read_ex(C, &read_homefile_params, nullptr, &params_file_read_post);
+  timer.step("home-file");
 
   /* NOTE: leave `G_MAIN->filepath` set to an empty string since this
    * matches behavior after loading a new file. */
@@ -304,6 +336,7 @@ void WM_init(bContext *C, int argc, const char **argv)
     GPU_context_end_frame(GPU_context_active_get());
     GPU_render_end();
   }
+  timer.step("gpu-and-ui");
 
   blender::bke::subdiv::init();
 
@@ -315,6 +348,7 @@ void WM_init(bContext *C, int argc, const char **argv)
 #else
   UNUSED_VARS(argc, argv);
 #endif
+  timer.step("python");
 
   if (!G.background) {
     if (wm_start_with_console) {
@@ -346,11 +380,14 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* Load add-ons after key-maps have been initialized (but before the blend file has been read),
    * important to guarantee default key-maps have been declared & before post-read handlers run. */
   wm_init_scripts_extensions_once(C);
+  timer.step("key-maps-and-add-ons");
 
   WM_keyconfig_update_postpone_end();
   WM_keyconfig_update(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
   wm_homefile_read_post(C, params_file_read_post);
+  timer.step("home-file-post");
+  timer.total();
 }
 
 static bool wm_init_splash_show_on_startup_check()
@@ -554,6 +591,8 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   }
 
   free_openrecent();
+  BLO_write_file_background_wait();
+  BLO_write_compression_cache_free();
 
   BKE_mball_cubeTable_free();
 
@@ -664,6 +703,9 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
+  /* Write the profile trace once the worker threads don't record zones anymore. */
+  blender::profile::stop();
+
   /* No need to call this early, rather do it late so that other
    * pieces of Blender using sound may exit cleanly, see also #50676. */
   BKE_sound_exit_once();
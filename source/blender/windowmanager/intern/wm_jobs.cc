@@ -402,6 +402,33 @@ static void *do_job_thread(void *job_v)
   return nullptr;
 }
 
+/**
+ * Jobs that keep all cores busy for a long time.
+ */
+static bool wm_job_type_uses_all_cores(const eWM_JobType job_type)
+{
+  return ELEM(job_type,
+              WM_JOB_TYPE_RENDER,
+              WM_JOB_TYPE_OBJECT_BAKE,
+              WM_JOB_TYPE_OBJECT_BAKE_TEXTURE,
+              WM_JOB_TYPE_OBJECT_SIM_FLUID,
+              WM_JOB_TYPE_LIGHT_BAKE,
+              WM_JOB_TYPE_BAKE_GEOMETRY_NODES);
+}
+
+/**
+ * Jobs that only fill caches for display and can wait, instead of competing for cores with the
+ * jobs above.
+ */
+static bool wm_job_type_is_background(const eWM_JobType job_type)
+{
+  return ELEM(job_type,
+              WM_JOB_TYPE_LOAD_PREVIEW,
+              WM_JOB_TYPE_SEQ_DRAW_THUMBNAIL,
+              WM_JOB_TYPE_SEQ_BUILD_PREVIEW,
+              WM_JOB_TYPE_FSMENU_BOOKMARK_VALIDATE);
+}
+
 /* Don't allow same startjob to be executed twice. */
 static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
 {
@@ -420,6 +447,15 @@ static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
         continue;
       }
 
+      /* Background jobs wait until the heavy ones are done, they are retried on every timer
+       * step while suspended. */
+      if (wm_job_type_is_background(test->job_type) &&
+          wm_job_type_uses_all_cores(wm_job->job_type))
+      {
+        suspend = true;
+        continue;
+      }
+
       /* If new job is not render, then check for same job type. */
       if (0 == (test->flag & WM_JOB_EXCL_RENDER)) {
         if (wm_job->job_type != test->job_type) {
@@ -25,6 +25,7 @@
 #  include "BLI_fileops.h"
 #  include "BLI_listbase.h"
 #  include "BLI_path_utils.hh"
+#  include "BLI_profile.hh"
 #  include "BLI_string.h"
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
@@ -745,6 +746,7 @@ static void print_help(bArgs *ba, bool all)
     BLI_args_print_arg_doc(ba, "--debug-cycles");
   }
   BLI_args_print_arg_doc(ba, "--debug-memory");
+  BLI_args_print_arg_doc(ba, "--debug-profile");
   BLI_args_print_arg_doc(ba, "--debug-jobs");
   BLI_args_print_arg_doc(ba, "--debug-python");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph");
@@ -1611,6 +1613,21 @@ static int arg_handle_debug_fpe_set(int /*argc*/, const char ** /*argv*/, void *
   return 0;
 }
 
+static const char arg_handle_debug_profile_set_doc[] =
+    "<filepath>\n"
+    "\tRecord profiling zones and write them as a trace to the file when Blender exits.\n"
+    "\tThe trace can be opened in Perfetto or 'chrome://tracing'.";
+static int arg_handle_debug_profile_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--debug-profile";
+  if (argc > 1) {
+    blender::profile::start(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_app_template_doc[] =
     "<template>\n"
     "\tSet the application template (matching the directory name), use 'default' for none.";
@@ -2822,6 +2839,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
     BLI_args_add(ba, nullptr, "--debug-cycles", CB(arg_handle_debug_mode_cycles), nullptr);
   }
   BLI_args_add(ba, nullptr, "--debug-memory", CB(arg_handle_debug_mode_memory_set), nullptr);
+  BLI_args_add(ba, nullptr, "--debug-profile", CB(arg_handle_debug_profile_set), nullptr);
 
   BLI_args_add(ba, nullptr, "--debug-value", CB(arg_handle_debug_value_set), nullptr);
   BLI_args_add(ba,
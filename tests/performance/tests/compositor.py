@@ -0,0 +1,78 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Build the node tree here, so the test doesn't depend on benchmark files. Without a Render
+    # Layers node only the compositor is evaluated when rendering.
+    scene = bpy.data.scenes.new("Compositor Test")
+    scene.render.resolution_x = 1920
+    scene.render.resolution_y = 1080
+    scene.render.resolution_percentage = 100
+    scene.render.use_compositing = True
+    scene.render.use_sequencer = False
+
+    image = bpy.data.images.new("Compositor Test", 1920, 1080, float_buffer=True)
+    image.generated_type = 'COLOR_GRID'
+
+    tree = bpy.data.node_groups.new("Compositor Test", 'CompositorNodeTree')
+    scene.compositing_node_group = tree
+    nodes = tree.nodes
+    links = tree.links
+
+    image_node = nodes.new('CompositorNodeImage')
+    image_node.image = image
+    blur = nodes.new('CompositorNodeBlur')
+    blur.inputs["Size"].default_value = (20.0, 20.0)
+    glare = nodes.new('CompositorNodeGlare')
+    composite = nodes.new('CompositorNodeComposite')
+    links.new(image_node.outputs["Image"], blur.inputs["Image"])
+    links.new(blur.outputs["Image"], glare.inputs["Image"])
+    links.new(glare.outputs["Image"], composite.inputs["Image"])
+
+    # Render once so allocations and compiled shaders are warmed up.
+    bpy.ops.render.render(scene=scene.name)
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 5
+    max_measurements = 100
+    timeout = 5
+
+    while True:
+        start_time = time.time()
+        bpy.ops.render.render(scene=scene.name)
+        measured_times.append(time.time() - start_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class CompositorRenderTest(api.Test):
+    def name(self):
+        return "blur_glare"
+
+    def category(self):
+        return "compositor_render"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    return [CompositorRenderTest()]
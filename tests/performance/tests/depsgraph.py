@@ -0,0 +1,120 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run_relations(args):
+    import bpy
+    import time
+
+    # Evaluate objects once first, so only the relations update is measured.
+    bpy.context.view_layer.update()
+
+    # Linking and unlinking an object tags the relations of the depsgraph for a rebuild.
+    ob = bpy.data.objects.new("Relations Test", None)
+    collection = bpy.context.scene.collection
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 5
+    max_measurements = 100
+    timeout = 5
+
+    while True:
+        collection.objects.link(ob)
+        start_time = time.time()
+        bpy.context.view_layer.update()
+        elapsed_time = time.time() - start_time
+        collection.objects.unlink(ob)
+        bpy.context.view_layer.update()
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+def _run_edit_mode(args):
+    import bpy
+    import time
+
+    bpy.context.view_layer.update()
+
+    # Toggle the mesh with the most vertices, that is the one users will notice.
+    meshes = [ob for ob in bpy.context.view_layer.objects if ob.type == 'MESH']
+    if not meshes:
+        return {}
+    ob = max(meshes, key=lambda ob: len(ob.data.vertices))
+    bpy.context.view_layer.objects.active = ob
+    if bpy.context.object.mode != 'OBJECT':
+        bpy.ops.object.mode_set(mode='OBJECT')
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 5
+    max_measurements = 100
+    timeout = 5
+
+    while True:
+        start_time = time.time()
+        bpy.ops.object.mode_set(mode='EDIT')
+        bpy.ops.object.mode_set(mode='OBJECT')
+        bpy.context.view_layer.update()
+        elapsed_time = time.time() - start_time
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class DepsgraphRelationsTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "depsgraph_relations"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run_relations, args, [self.filepath])
+        return result
+
+
+class EditModeToggleTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "edit_mode_toggle"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run_edit_mode, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    # Animated characters have many objects and relations, the sculpt file has a single dense mesh.
+    return ([DepsgraphRelationsTest(filepath) for filepath in env.find_blend_files('animation/*')] +
+            [EditModeToggleTest(filepath) for filepath in env.find_blend_files('sculpt/*')])
@@ -0,0 +1,66 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    file_format = args['format']
+    export_op = getattr(bpy.ops.wm, file_format + "_export")
+    import_op = getattr(bpy.ops.wm, file_format + "_import")
+
+    # Export a dense generated mesh first, so the test doesn't depend on benchmark files.
+    bpy.ops.wm.read_factory_settings(use_empty=True)
+    bpy.ops.mesh.primitive_grid_add(x_subdivisions=1000, y_subdivisions=1000, size=2.0)
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        filepath = os.path.join(tempdir, "import_test." + file_format)
+        export_op(filepath=filepath)
+
+        test_time_start = time.time()
+        measured_times = []
+
+        min_measurements = 5
+        max_measurements = 100
+        timeout = 5
+
+        while True:
+            bpy.ops.wm.read_factory_settings(use_empty=True)
+            start_time = time.time()
+            import_op(filepath=filepath)
+            measured_times.append(time.time() - start_time)
+
+            if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+                break
+            if len(measured_times) >= max_measurements:
+                break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class ImportTest(api.Test):
+    def __init__(self, file_format):
+        self.file_format = file_format
+
+    def name(self):
+        return self.file_format
+
+    def category(self):
+        return "import"
+
+    def run(self, env, device_id):
+        args = {'format': self.file_format}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    return [ImportTest(file_format) for file_format in ('obj', 'ply', 'stl')]
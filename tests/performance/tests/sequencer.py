@@ -0,0 +1,64 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Build the strips here, so the test doesn't depend on benchmark files.
+    scene = bpy.data.scenes.new("Sequencer Test")
+    scene.render.resolution_x = 1920
+    scene.render.resolution_y = 1080
+    scene.render.resolution_percentage = 100
+    scene.render.use_sequencer = True
+    scene.frame_start = 1
+    scene.frame_end = 20
+
+    strips = scene.sequence_editor_create().strips
+    color = strips.new_effect("Color", 'COLOR', 1, frame_start=1, frame_end=21)
+    color.color = (0.8, 0.2, 0.1)
+    blur = strips.new_effect("Blur", 'GAUSSIAN_BLUR', 2, frame_start=1, frame_end=21, input1=color)
+    blur.size_x = 20.0
+    blur.size_y = 20.0
+    transform = strips.new_effect("Transform", 'TRANSFORM', 3, frame_start=1, frame_end=21, input1=blur)
+    transform.rotation_start = 15.0
+    overlay = strips.new_effect("Overlay", 'COLOR', 4, frame_start=1, frame_end=21)
+    overlay.color = (0.1, 0.3, 0.9)
+    overlay.blend_type = 'ALPHA_OVER'
+    overlay.blend_alpha = 0.5
+
+    # Render the first frame once so allocations are warmed up, it is not measured since it may
+    # be cached now.
+    scene.frame_set(scene.frame_start)
+    bpy.ops.render.render(scene=scene.name)
+
+    start_time = time.time()
+    for frame in range(scene.frame_start + 1, scene.frame_end + 1):
+        scene.frame_set(frame)
+        bpy.ops.render.render(scene=scene.name)
+    elapsed_time = time.time() - start_time
+
+    num_frames = scene.frame_end - scene.frame_start
+    result = {'time': elapsed_time / num_frames}
+    return result
+
+
+class SequencerRenderTest(api.Test):
+    def name(self):
+        return "effect_strips"
+
+    def category(self):
+        return "sequencer_render"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    return [SequencerRenderTest()]
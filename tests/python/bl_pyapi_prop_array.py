@@ -380,6 +380,40 @@ class TestPropArrayInvalidForeachGetSet(unittest.TestCase):
             me.vertices.foreach_set("co", invalid_3f_list)
 
 
+
+class TestPropArrayForeachSetConvert(unittest.TestCase):
+    """
+    Test that foreach_set clamps values to the property range when the buffer type doesn't match.
+    """
+
+    def setUp(self):
+        self.cu = bpy.data.curves.new("", 'CURVE')
+        self.spline = self.cu.splines.new('POLY')
+        self.spline.points.add(3)
+
+    def tearDown(self):
+        bpy.data.curves.remove(self.cu)
+        self.cu = None
+        self.spline = None
+
+    def test_foreach_set_clamp(self):
+        points = self.spline.points
+        for dtype in (np.float64, np.int32):
+            points.foreach_set("radius", np.array((-5, 0, 2, 7), dtype=dtype))
+            self.assertEqual(tuple(p.radius for p in points), (0.0, 0.0, 2.0, 7.0))
+
+            points.foreach_set("weight_softbody", np.array((-5, 0, 2, 1000), dtype=dtype))
+            for point, expected in zip(points, (0.01, 0.01, 2.0, 100.0)):
+                self.assertAlmostEqual(point.weight_softbody, expected, places=6)
+
+    def test_foreach_get_convert(self):
+        points = self.spline.points
+        points.foreach_set("radius", (0.5, 1.0, 1.5, 2.0))
+        values = np.zeros(len(points), dtype=np.float64)
+        points.foreach_get("radius", values)
+        self.assertEqual(tuple(values), (0.5, 1.0, 1.5, 2.0))
+
+
 if __name__ == '__main__':
     import sys
     sys.argv = [__file__] + (sys.argv[sys.argv.index("--") + 1:] if "--" in sys.argv else [])